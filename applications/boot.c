@@ -4,6 +4,10 @@
 #include <string.h>
 #include "crc32.h"
 #include <rthw.h>
+#include <hpm_dma_drv.h>
+#ifdef BSP_USING_SDXC
+#include <hpm_sdxc_drv.h>
+#endif
 
 #define DBG_TAG "boot"
 #define DBG_LVL DBG_LOG
@@ -48,24 +52,19 @@ static void print_progress(size_t cur_size, size_t total_size) {
     LOG_I("OTA Write: [%s] %d%%", progress_sign, per);
 }
 
-static int get_firm_header(const struct fal_partition *part, uint32_t off, firm_pkg_t *firm_pkg) {
-    if (fal_partition_read(part, off, (uint8_t *)firm_pkg, sizeof(firm_pkg_t)) < 0) {
-        LOG_E("Partition[%s] read head error!", part->name);
-        return -RT_ERROR;
-    }
-
+static int check_firm_header(const char *name, firm_pkg_t *firm_pkg) {
     uint32_t calc_crc;
     crc32_ctx ctx;
     crc32_init(&ctx);
     crc32_update(&ctx, (uint8_t *)firm_pkg, sizeof(firm_pkg_t) - 4);
     crc32_final(&ctx, &calc_crc);
     if (calc_crc != firm_pkg->hdr_crc32) {
-        LOG_E("Partition[%s] head CRC32 error!", part->name);
+        LOG_E("Partition[%s] head CRC32 error!", name);
         return -RT_ERROR;
     }
 
     if (strncmp(firm_pkg->type, "RBL", 3) != 0) {
-        LOG_E("Partition[%s] type[%s] not surport.", part->name, firm_pkg->type);
+        LOG_E("Partition[%s] type[%s] not surport.", name, firm_pkg->type);
         return -RT_ERROR;
     }
 
@@ -82,6 +81,15 @@ static int get_firm_header(const struct fal_partition *part, uint32_t off, firm_
     return RT_EOK;
 }
 
+static int get_firm_header(const struct fal_partition *part, uint32_t off, firm_pkg_t *firm_pkg) {
+    if (fal_partition_read(part, off, (uint8_t *)firm_pkg, sizeof(firm_pkg_t)) < 0) {
+        LOG_E("Partition[%s] read head error!", part->name);
+        return -RT_ERROR;
+    }
+
+    return check_firm_header(part->name, firm_pkg);
+}
+
 static int calc_part_firm_crc32(const struct fal_partition *part, uint32_t firm_len,
                                 uint32_t firm_off, uint32_t *calc_crc) {
     int total_length = 0, length = 0;
@@ -129,6 +137,71 @@ int check_part_firm(const struct fal_partition *part, firm_pkg_t *firm_pkg) {
     return RT_EOK;
 }
 
+void firm_verify_init(firm_verify_t *verify, const char *name) {
+    rt_memset(verify, 0, sizeof(firm_verify_t));
+    verify->name = name;
+    verify->state = FIRM_VERIFY_HEADER;
+    crc32_init(&verify->ctx);
+}
+
+int firm_verify_update(firm_verify_t *verify, const uint8_t *data, size_t len) {
+    if (verify->state == FIRM_VERIFY_ERROR) return -RT_ERROR;
+
+    if (verify->state == FIRM_VERIFY_HEADER) {
+        size_t need = sizeof(firm_pkg_t) - verify->offset;
+        if (need > len) need = len;
+
+        rt_memcpy((uint8_t *)&verify->header + verify->offset, data, need);
+        verify->offset += need;
+        data += need;
+        len -= need;
+        if (verify->offset < sizeof(firm_pkg_t)) return RT_EOK;
+
+        if (check_firm_header(verify->name, &verify->header) != RT_EOK) {
+            verify->state = FIRM_VERIFY_ERROR;
+            return -RT_ERROR;
+        }
+        verify->state = FIRM_VERIFY_BODY;
+    }
+
+    /* bytes after raw_size are padding, they are counted but not part of body crc */
+    uint32_t body_off = verify->offset - sizeof(firm_pkg_t);
+    if (body_off < verify->header.raw_size) {
+        uint32_t body_len = verify->header.raw_size - body_off;
+        crc32_update(&verify->ctx, data, len > body_len ? body_len : len);
+    }
+    verify->offset += len;
+
+    return RT_EOK;
+}
+
+int firm_verify_final(firm_verify_t *verify) {
+    uint32_t calc_crc;
+
+    if (verify->state != FIRM_VERIFY_BODY) {
+        LOG_E("Partition[%s] head incomplete or invalid!", verify->name);
+        return -RT_ERROR;
+    }
+
+    if (verify->offset - sizeof(firm_pkg_t) < verify->header.raw_size) {
+        LOG_E("Partition[%s] body truncated(%d < %d)!", verify->name,
+              verify->offset - sizeof(firm_pkg_t), verify->header.raw_size);
+        return -RT_ERROR;
+    }
+
+    crc32_final(&verify->ctx, &calc_crc);
+    if (verify->header.body_crc32 != calc_crc) {
+        LOG_E(
+            "Get firmware header occur CRC32(calc.crc: %08X != hdr.info_crc32: %08X) error on "
+            "\'%s\' partition!",
+            calc_crc, verify->header.body_crc32, verify->name);
+        return -RT_ERROR;
+    }
+    LOG_I("Verify \'%s\' partiton(fw ver: %s, timestamp: %d) success.", verify->name,
+          verify->header.version_name, verify->header.time_stamp);
+    return RT_EOK;
+}
+
 int firm_upgrade(const struct fal_partition *src_part, firm_pkg_t *src_header,
                  const struct fal_partition *app_part) {
     rt_err_t result = RT_EOK;
@@ -180,10 +253,90 @@ int firm_upgrade(const struct fal_partition *src_part, firm_pkg_t *src_header,
     return result;
 }
 
+#define BOOT_PLIC_IRQ_MAX  IRQn_DEBUG_1
+#define BOOT_SDXC_TIMEOUT  0xFFFFUL
+
+/* RTC time in 16.16 seconds, it keeps counting across the software reset */
+static uint32_t boot_rtc_stamp(void) {
+    uint32_t sec, subsec;
+
+    do {
+        sec = HPM_RTC->SECOND;
+        subsec = HPM_RTC->SUBSEC;
+    } while (sec != HPM_RTC->SECOND);
+
+    return (sec << 16) | (subsec >> 16);
+}
+
+static void boot_handoff_record(uint32_t path) {
+    uint64_t us = ((uint64_t)(boot_rtc_stamp() - BOOT_HANDOFF_STAMP) * 1000000UL) >> 16;
+    if (us > BOOT_HANDOFF_COST_US_MASK) us = BOOT_HANDOFF_COST_US_MASK;
+
+    BOOT_HANDOFF_COST = path | BOOT_HANDOFF_VALID | (uint32_t)us;
+}
+
+static void boot_jump(void) {
+    l1c_dc_writeback_all();
+    l1c_dc_disable();
+    l1c_ic_disable();
+    fencei();
+    __asm("la a0, %0" ::"i"(BOOT_APP_ADDR));
+    __asm("jr a0");
+}
+
+#if BOOT_DIRECT_HANDOFF
+static void boot_enet_stop(ENET_Type *enet) {
+    enet->DMA_INTR_EN = 0;
+    enet->DMA_OP_MODE &= ~(ENET_DMA_OP_MODE_ST_MASK | ENET_DMA_OP_MODE_SR_MASK);
+    enet->MACCFG &= ~(ENET_MACCFG_TE_MASK | ENET_MACCFG_RE_MASK);
+}
+
+/*
+ * Leave the chip the way the app startup code expects after a reset, then jump:
+ *  - mstatus.MIE, mie.MEIE/MTIE/MSIE cleared, every PLIC source disabled, threshold 0;
+ *  - HDMA and XDMA reset, ethernet DMA and MAC stopped, SDXC reset;
+ *  - D-cache written back and disabled, I-cache disabled.
+ * Clocks, pin mux and SDRAM stay as board_init() set them, the app sets them up again.
+ */
+static void boot_handoff(void) {
+    disable_global_irq(CSR_MSTATUS_MIE_MASK);
+    disable_irq_from_intc();
+    disable_mchtmr_irq();
+    intc_m_disable_swi();
+    for (uint32_t irq = 1; irq <= BOOT_PLIC_IRQ_MAX; irq++) intc_m_disable_irq(irq);
+    intc_m_set_threshold(0);
+
+    dma_reset(HPM_HDMA);
+    dma_reset(HPM_XDMA);
+#ifdef BSP_USING_ETH0
+    boot_enet_stop(HPM_ENET0);
+#endif
+#ifdef BSP_USING_ETH1
+    boot_enet_stop(HPM_ENET1);
+#endif
+#ifdef BSP_USING_SDXC0
+    sdxc_reset(HPM_SDXC0, sdxc_reset_all, BOOT_SDXC_TIMEOUT);
+#endif
+#ifdef BSP_USING_SDXC1
+    sdxc_reset(HPM_SDXC1, sdxc_reset_all, BOOT_SDXC_TIMEOUT);
+#endif
+
+    boot_handoff_record(0);
+    boot_jump();
+}
+#endif
+
 void boot_app_enable(void) {
+    /* sectors a file system wrote through a FAL block device may still be in its cache */
+    fal_blk_device_sync();
     rt_hw_interrupt_disable();
+    BOOT_HANDOFF_STAMP = boot_rtc_stamp();
+#if BOOT_DIRECT_HANDOFF
+    boot_handoff();
+#else
     BOOT_BKP = 0xA5A5;
     ppor_sw_reset(HPM_PPOR, 10);
+#endif
 }
 
 void boot_start_application(void) {
@@ -192,10 +345,16 @@ void boot_start_application(void) {
 
     if (bkp_data != 0xA5A5) return;
 
-    l1c_dc_writeback_all();
-    l1c_dc_disable();
-    l1c_ic_disable();
-    fencei();
-    __asm("la a0, %0" ::"i"(BOOT_APP_ADDR));
-    __asm("jr a0");
+    boot_handoff_record(BOOT_HANDOFF_RESET);
+    boot_jump();
+}
+
+void boot_handoff_report(void) {
+    uint32_t cost = BOOT_HANDOFF_COST;
+    BOOT_HANDOFF_COST = 0;
+
+    if (!(cost & BOOT_HANDOFF_VALID)) return;
+
+    LOG_I("last jump to app by %s: %u us", (cost & BOOT_HANDOFF_RESET) ? "reset" : "direct",
+          cost & BOOT_HANDOFF_COST_US_MASK);
 }
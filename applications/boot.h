@@ -2,11 +2,31 @@
 #define __BOOT_H
 #include <stdint.h>
 #include "common.h"
+#include "crc32.h"
+
+enum {
+    FIRM_VERIFY_HEADER = 0,
+    FIRM_VERIFY_BODY,
+    FIRM_VERIFY_ERROR,
+};
+
+/* streaming check of a package laid out as "header + body", fed in write order */
+typedef struct {
+    const char *name;
+    firm_pkg_t header;
+    uint32_t offset;
+    crc32_ctx ctx;
+    int state;
+} firm_verify_t;
 
 int check_part_firm(const struct fal_partition *part, firm_pkg_t *firm_pkg);
 int firm_upgrade(const struct fal_partition *src_part, firm_pkg_t *src_header,
                  const struct fal_partition *app_part);
+void firm_verify_init(firm_verify_t *verify, const char *name);
+int firm_verify_update(firm_verify_t *verify, const uint8_t *data, size_t len);
+int firm_verify_final(firm_verify_t *verify);
 void boot_app_enable(void);
 void boot_start_application(void);
+void boot_handoff_report(void);
 
 #endif
@@ -1,8 +1,23 @@
 #ifndef __COMMON_H
 #define __COMMON_H
+#include <rtthread.h>
 #include <fal.h>
 
 #define BOOT_BKP           (HPM_BGPR->BATT_GPR7)
+#define BOOT_HANDOFF_STAMP (HPM_BGPR->BATT_GPR6) /* RTC time boot_app_enable() was called, 16.16 s */
+#define BOOT_HANDOFF_COST  (HPM_BGPR->BATT_GPR5) /* BOOT_HANDOFF_xxx | microseconds to the jump */
+#define BOOT_HANDOFF_RESET       (1UL << 31) /* went through the software reset */
+#define BOOT_HANDOFF_VALID       (1UL << 30)
+#define BOOT_HANDOFF_COST_US_MASK 0x3FFFFFFFUL
+/* 1: jump to the app from the running boot, 0: software reset and jump before RT-Thread starts.
+ * Compare BOOT_HANDOFF_STAMP/COST of both on the board before turning the direct jump on. */
+#ifndef BOOT_DIRECT_HANDOFF
+#define BOOT_DIRECT_HANDOFF 0
+#endif
+/* 1: an sd card package is checked on the card and written straight to app, 0: staged in download */
+#ifndef SDCARD_DIRECT_INSTALL
+#define SDCARD_DIRECT_INSTALL 1
+#endif
 #define BOOT_APP_ADDR      0x80100000UL
 #define ENTER_BOOT_TIMEOUT 500
 #define APP_PART_NAME      "app"
@@ -32,13 +47,30 @@ enum {
     SYSTEM_STEP_ERROR
 };
 
+/* g_system.event bits, system_process() sleeps until one of them comes */
+#define SYSTEM_EVENT_WIFI_READY    (1 << 0) /* soft-AP started */
+#define SYSTEM_EVENT_ETH_READY     (1 << 1) /* ethernet addressing configured */
+#define SYSTEM_EVENT_SERVICE_READY (1 << 2) /* web and tftp servers listening */
+#define SYSTEM_EVENT_SDCARD        (1 << 3) /* sd card check finished or card put in, see sdcard_check() */
+#define SYSTEM_EVENT_RS485_RX      (1 << 4) /* bytes received on the rs485 uart */
+#define SYSTEM_EVENT_KEY           (1 << 5) /* key pressed */
+#define SYSTEM_EVENT_QUIT          (1 << 6) /* firmware received, see system_quit() */
+#define SYSTEM_EVENT_ALL           0x7F
+
 typedef struct {
     const struct fal_partition *app_part;
     const struct fal_partition *download_part;
     int is_remain;
     int is_quit;
     int step;
+    int download_verified; /* download_header checked while it was received */
+    firm_pkg_t download_header;
+    struct rt_event event; /* SYSTEM_EVENT_xxx */
 } g_system_t;
 extern g_system_t g_system;
 
+void system_quit(void);
+int system_update_take(const char *owner);
+void system_update_release(void);
+
 #endif
@@ -0,0 +1,404 @@
+#include "http_ota.h"
+#include "common.h"
+#include "boot.h"
+#include <rtthread.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <netdb.h>
+
+#define DBG_TAG "http.ota"
+#define DBG_LVL DBG_LOG
+#include <rtdbg.h>
+
+/* number of parallel range connections, each one is limited by the TCP window of lwIP */
+#define HTTP_OTA_CONN_NUM     3
+#define HTTP_OTA_RETRY        3
+#define HTTP_OTA_BUF_SIZE     4096
+#define HTTP_OTA_RANGE_ALIGN  4096
+#define HTTP_OTA_HOST_LEN     64
+#define HTTP_OTA_PATH_LEN     256
+#define HTTP_OTA_RECV_TIMEOUT 5
+#define HTTP_OTA_STACK_SIZE   3072
+#define HTTP_OTA_PRIORITY     20
+
+typedef struct {
+    int index;
+    uint32_t end;    /* last byte of the range */
+    uint32_t offset; /* next byte to fetch */
+} http_ota_range_t;
+
+static struct {
+    char host[HTTP_OTA_HOST_LEN];
+    char path[HTTP_OTA_PATH_LEN];
+    int port;
+    int state;
+    uint32_t total_size;
+    uint32_t recv_size;
+    uint8_t progress;
+    http_ota_range_t ranges[HTTP_OTA_CONN_NUM];
+    rt_mutex_t lock;
+    rt_sem_t done;
+} _ota = {0};
+
+static int http_ota_parse_url(const char *url) {
+    const char *host, *port, *path;
+
+    if (strncmp(url, "http://", 7) != 0) {
+        LOG_W("only http:// url is supported.");
+        return -RT_ERROR;
+    }
+
+    host = url + 7;
+    path = strchr(host, '/');
+    if (path == RT_NULL) path = host + strlen(host);
+
+    port = memchr(host, ':', path - host);
+    if (port == RT_NULL) port = path;
+
+    if ((port == host) || (port - host >= HTTP_OTA_HOST_LEN) ||
+        (strlen(path) >= HTTP_OTA_PATH_LEN)) {
+        LOG_W("url %s is invalid.", url);
+        return -RT_ERROR;
+    }
+
+    memcpy(_ota.host, host, port - host);
+    _ota.host[port - host] = '\0';
+    _ota.port = (*port == ':') ? atoi(port + 1) : 80;
+    strcpy(_ota.path, (*path == '\0') ? "/" : path);
+
+    return RT_EOK;
+}
+
+static int http_ota_connect(void) {
+    struct addrinfo hints = {0}, *res = RT_NULL;
+    char port[8];
+    int sock = -1;
+
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    snprintf(port, sizeof(port), "%d", _ota.port);
+    if ((getaddrinfo(_ota.host, port, &hints, &res) != 0) || (res == RT_NULL)) {
+        LOG_W("resolve host %s failed.", _ota.host);
+        return -1;
+    }
+
+    sock = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (sock >= 0) {
+        struct timeval timeout = {HTTP_OTA_RECV_TIMEOUT, 0};
+        setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+        if (connect(sock, res->ai_addr, res->ai_addrlen) != 0) {
+            LOG_W("connect %s:%d failed.", _ota.host, _ota.port);
+            closesocket(sock);
+            sock = -1;
+        }
+    }
+    freeaddrinfo(res);
+
+    return sock;
+}
+
+static const char *http_ota_get_header(const char *head, const char *name) {
+    size_t len = strlen(name);
+    const char *line = strstr(head, "\r\n");
+
+    while ((line != RT_NULL) && (line[2] != '\r')) {
+        line += 2;
+        if (strncasecmp(line, name, len) == 0) {
+            line += len;
+            while (*line == ' ') line++;
+            return line;
+        }
+        line = strstr(line, "\r\n");
+    }
+
+    return RT_NULL;
+}
+
+/**
+ * Send a range request and receive the response head.
+ * The body bytes received with the head are moved to the start of buf.
+ *
+ * @return the http status code, < 0 on error
+ */
+static int http_ota_request(int sock, uint32_t start, uint32_t end, char *buf, int *body_len,
+                            uint32_t *total_size) {
+    char *head_end = RT_NULL;
+    const char *value;
+    int len, code;
+
+    len = snprintf(buf, HTTP_OTA_BUF_SIZE,
+                   "GET %s HTTP/1.1\r\nHost: %s\r\nRange: bytes=%u-%u\r\nConnection: close\r\n\r\n",
+                   _ota.path, _ota.host, start, end);
+    if (send(sock, buf, len, 0) != len) return -RT_ERROR;
+
+    len = 0;
+    while (head_end == RT_NULL) {
+        if (len >= HTTP_OTA_BUF_SIZE - 1) return -RT_ERROR;
+
+        int rc = recv(sock, buf + len, HTTP_OTA_BUF_SIZE - 1 - len, 0);
+        if (rc <= 0) return -RT_ERROR;
+
+        len += rc;
+        buf[len] = '\0';
+        head_end = strstr(buf, "\r\n\r\n");
+    }
+    head_end += 4;
+
+    if (strncmp(buf, "HTTP/1.", 7) != 0) return -RT_ERROR;
+    code = atoi(buf + 9);
+
+    *total_size = 0;
+    if (code == 206) {
+        /* Content-Range: bytes start-end/total */
+        value = http_ota_get_header(buf, "Content-Range:");
+        if (value != RT_NULL) value = strchr(value, '/');
+        if (value != RT_NULL) *total_size = strtoul(value + 1, RT_NULL, 10);
+    } else if (code == 200) {
+        value = http_ota_get_header(buf, "Content-Length:");
+        if (value != RT_NULL) *total_size = strtoul(value, RT_NULL, 10);
+    }
+
+    *body_len = len - (head_end - buf);
+    memmove(buf, head_end, *body_len);
+
+    return code;
+}
+
+static int http_ota_write(uint32_t offset, const uint8_t *data, int len) {
+    int rc;
+
+    /* ranges are written from different threads, the flash is accessed one by one */
+    rt_mutex_take(_ota.lock, RT_WAITING_FOREVER);
+    rc = fal_partition_write(g_system.download_part, offset, data, len);
+    if (rc > 0) {
+        _ota.recv_size += len;
+        if (_ota.recv_size * 10 / _ota.total_size != _ota.progress) {
+            _ota.progress = _ota.recv_size * 10 / _ota.total_size;
+            LOG_I("download %d%% (%u/%u)", _ota.progress * 10, _ota.recv_size, _ota.total_size);
+        }
+    }
+    rt_mutex_release(_ota.lock);
+
+    return (rc > 0) ? RT_EOK : -RT_ERROR;
+}
+
+static int http_ota_fetch(http_ota_range_t *range, char *buf) {
+    uint32_t total_size;
+    int body_len, rc = -RT_ERROR;
+
+    int sock = http_ota_connect();
+    if (sock < 0) return -RT_ERROR;
+
+    do {
+        int code = http_ota_request(sock, range->offset, range->end, buf, &body_len, &total_size);
+        if ((code != 206) && !(code == 200 && range->offset == 0)) {
+            LOG_W("range[%d] response code %d.", range->index, code);
+            break;
+        }
+
+        while (1) {
+            uint32_t need = range->end + 1 - range->offset;
+            if ((uint32_t)body_len > need) body_len = need;
+
+            if (body_len > 0) {
+                if (http_ota_write(range->offset, (uint8_t *)buf, body_len) != RT_EOK) {
+                    rc = -RT_EIO;
+                    break;
+                }
+                range->offset += body_len;
+            }
+
+            if (range->offset > range->end) {
+                rc = RT_EOK;
+                break;
+            }
+
+            body_len = recv(sock, buf, HTTP_OTA_BUF_SIZE, 0);
+            if (body_len <= 0) break;
+        }
+    } while (0);
+
+    closesocket(sock);
+
+    return rc;
+}
+
+static void http_ota_worker(void *parameter) {
+    http_ota_range_t *range = (http_ota_range_t *)parameter;
+    int retry = 0;
+
+    char *buf = rt_malloc(HTTP_OTA_BUF_SIZE);
+    while ((buf != RT_NULL) && (range->offset <= range->end)) {
+        int rc = http_ota_fetch(range, buf);
+        if (rc == RT_EOK) break;
+
+        /* offset only moves after a good write, a broken connection resumes on erased flash.
+         * A failed write may have programmed part of the block, it is not written again. */
+        if (rc == -RT_EIO) {
+            LOG_E("range[%d] write failed at %u.", range->index, range->offset);
+            break;
+        }
+
+        if (++retry >= HTTP_OTA_RETRY) break;
+        LOG_W("range[%d] broken at %u, retry %d.", range->index, range->offset, retry);
+    }
+    rt_free(buf);
+
+    rt_sem_release(_ota.done);
+}
+
+static int http_ota_download(char *buf) {
+    const struct fal_partition *part = g_system.download_part;
+    uint32_t total_size = 0, range_size;
+    int body_len, conn_num, started = 0;
+
+    /* probe the file size and whether the server supports range requests */
+    int sock = http_ota_connect();
+    if (sock < 0) return -RT_ERROR;
+    int code = http_ota_request(sock, 0, 0, buf, &body_len, &total_size);
+    closesocket(sock);
+
+    if (code == 206) {
+        conn_num = HTTP_OTA_CONN_NUM;
+    } else if (code == 200) {
+        LOG_W("server does not support range, using one connection.");
+        conn_num = 1;
+    } else {
+        LOG_E("http://%s:%d%s response code %d.", _ota.host, _ota.port, _ota.path, code);
+        return -RT_ERROR;
+    }
+
+    if ((total_size == 0) || (total_size > part->len)) {
+        LOG_E("firm size (%u) is invalid, partition size (%d)", total_size, part->len);
+        return -RT_ERROR;
+    }
+    _ota.total_size = total_size;
+    LOG_I("firm size %u, %d connections.", total_size, conn_num);
+
+    LOG_I("The partition \'%s\' is erasing.", part->name);
+    if (fal_partition_erase_all(part) < 0) return -RT_ERROR;
+    LOG_I("The partition \'%s\' erase success.", part->name);
+
+    range_size = RT_ALIGN(total_size / conn_num, HTTP_OTA_RANGE_ALIGN);
+    for (int i = 0; i < conn_num; i++) {
+        http_ota_range_t *range = &_ota.ranges[i];
+        uint32_t start = i * range_size;
+
+        if (start > total_size) start = total_size;
+        range->index = i;
+        range->offset = start;
+        range->end = (i == conn_num - 1) ? total_size - 1 : start + range_size - 1;
+        if (range->end >= total_size) range->end = total_size - 1;
+        if (range->offset > range->end) continue;
+
+        char name[RT_NAME_MAX];
+        rt_snprintf(name, sizeof(name), "ota%d", i);
+        rt_thread_t tid = rt_thread_create(name, http_ota_worker, range, HTTP_OTA_STACK_SIZE,
+                                           HTTP_OTA_PRIORITY, 10);
+        if (tid == RT_NULL) {
+            LOG_E("create thread %s failed.", name);
+            break;
+        }
+        rt_thread_startup(tid);
+        started++;
+    }
+
+    while (started--) rt_sem_take(_ota.done, RT_WAITING_FOREVER);
+
+    for (int i = 0; i < conn_num; i++) {
+        if (_ota.ranges[i].offset <= _ota.ranges[i].end) {
+            LOG_E("range[%d] incomplete at %u.", i, _ota.ranges[i].offset);
+            return -RT_ERROR;
+        }
+    }
+
+    return RT_EOK;
+}
+
+static void http_ota_entry(void *parameter) {
+    firm_pkg_t header = {0};
+    int rc = -RT_ERROR;
+
+    char *buf = rt_malloc(HTTP_OTA_BUF_SIZE);
+    if (buf != RT_NULL) {
+        rt_tick_t tick = rt_tick_get();
+
+        rc = http_ota_download(buf);
+        if (rc == RT_EOK) {
+            LOG_I("download %u bytes in %u ms.", _ota.total_size,
+                  (rt_tick_get() - tick) * 1000 / RT_TICK_PER_SECOND);
+            rc = check_part_firm(g_system.download_part, &header);
+        }
+        rt_free(buf);
+    }
+
+    if (rc != RT_EOK) {
+        LOG_E("http ota failed.");
+        _ota.state = HTTP_OTA_STATE_FAIL;
+        system_update_release();
+        return;
+    }
+
+    g_system.download_header = header;
+    g_system.download_verified = 1;
+    _ota.state = HTTP_OTA_STATE_OK;
+    system_quit();
+    system_update_release();
+}
+
+int http_ota_start(const char *url) {
+    /* also owns _ota until http_ota_entry() is done, a second start is rejected here */
+    if (system_update_take("http") != RT_EOK) return -RT_EBUSY;
+
+    int rc = http_ota_parse_url(url);
+    if ((rc == RT_EOK) && (_ota.lock == RT_NULL)) {
+        _ota.lock = rt_mutex_create("ota", RT_IPC_FLAG_PRIO);
+        _ota.done = rt_sem_create("ota", 0, RT_IPC_FLAG_FIFO);
+        if ((_ota.lock == RT_NULL) || (_ota.done == RT_NULL)) {
+            LOG_E("create ota lock failed.");
+            rc = -RT_ENOMEM;
+        }
+    }
+
+    rt_thread_t tid = RT_NULL;
+    if (rc == RT_EOK) {
+        _ota.total_size = 0;
+        _ota.recv_size = 0;
+        _ota.progress = 0;
+        g_system.download_verified = 0;
+
+        tid = rt_thread_create("http_ota", http_ota_entry, RT_NULL, HTTP_OTA_STACK_SIZE,
+                               HTTP_OTA_PRIORITY, 10);
+        if (tid == RT_NULL) rc = -RT_ENOMEM;
+    }
+    if (rc != RT_EOK) {
+        system_update_release();
+        return rc;
+    }
+
+    LOG_I("download http://%s:%d%s", _ota.host, _ota.port, _ota.path);
+    _ota.state = HTTP_OTA_STATE_RUNNING;
+    rt_thread_startup(tid);
+
+    return RT_EOK;
+}
+
+int http_ota_get_state(uint32_t *recv_size, uint32_t *total_size) {
+    if (recv_size) *recv_size = _ota.recv_size;
+    if (total_size) *total_size = _ota.total_size;
+
+    return _ota.state;
+}
+
+static int http_ota(int argc, char **argv) {
+    if (argc != 2) {
+        rt_kprintf("Usage: http_ota http://host[:port]/path/rtthread.rbl\n");
+        return -RT_ERROR;
+    }
+
+    return http_ota_start(argv[1]);
+}
+MSH_CMD_EXPORT(http_ota, download firmware with parallel http range requests);
@@ -0,0 +1,10 @@
+#ifndef __HTTP_OTA_H
+#define __HTTP_OTA_H
+#include <stdint.h>
+
+enum { HTTP_OTA_STATE_IDLE = 0, HTTP_OTA_STATE_RUNNING, HTTP_OTA_STATE_OK, HTTP_OTA_STATE_FAIL };
+
+int http_ota_start(const char *url);
+int http_ota_get_state(uint32_t *recv_size, uint32_t *total_size);
+
+#endif
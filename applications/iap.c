@@ -16,11 +16,19 @@
 
 #define RS485_DEVICE_NAME "uart6"
 
-static rt_sem_t _rx_notice = RT_NULL;
+/* silence that ends a modbus rtu frame */
+#define RS485_FRAME_TIMEOUT 15
+
 static rt_device_t _rs485_dev = RT_NULL;
 
+static uint8_t _ctx_send_buf[AGILE_MODBUS_MAX_ADU_LENGTH];
+static uint8_t _ctx_read_buf[5000];
+static agile_modbus_rtu_t _ctx_rtu;
+static int _remain_length = 0;
+static rt_tick_t _rx_tick = 0;
+
 static rt_err_t rs485_rx_ind(rt_device_t dev, rt_size_t size) {
-    rt_sem_release(_rx_notice);
+    rt_event_send(&g_system.event, SYSTEM_EVENT_RS485_RX);
 
     return RT_EOK;
 }
@@ -31,23 +39,15 @@ static int rs485_init(void) {
     RS485_EN_RX();
 
     /* device init */
-    _rx_notice = rt_sem_create("485_rx", 0, RT_IPC_FLAG_FIFO);
-    if (_rx_notice == RT_NULL) {
-        LOG_E("create rx sem failed.");
-        return -RT_ERROR;
-    }
-
     _rs485_dev = rt_device_find(RS485_DEVICE_NAME);
     if (_rs485_dev == RT_NULL) {
         LOG_E("find rs485 device (%s) failed.", RS485_DEVICE_NAME);
-        rt_sem_delete(_rx_notice);
         return -RT_ERROR;
     }
     rt_device_set_rx_indicate(_rs485_dev, rs485_rx_ind);
 
     if (rt_device_open(_rs485_dev, RT_DEVICE_OFLAG_RDWR | RT_DEVICE_FLAG_INT_RX) != RT_EOK) {
         LOG_E("open rs485 device (%s) failed.", RS485_DEVICE_NAME);
-        rt_sem_delete(_rx_notice);
         return -RT_ERROR;
     }
 
@@ -64,52 +64,59 @@ static int rs485_send(uint8_t *buf, int len) {
     return len;
 }
 
-static int rs485_receive(uint8_t *buf, int bufsz, int timeout) {
+/* what the uart holds now, the rx indicate event tells when more comes */
+static int rs485_receive(uint8_t *buf, int bufsz) {
     int len = 0;
 
-    while (1) {
-        rt_sem_control(_rx_notice, RT_IPC_CMD_RESET, RT_NULL);
-
+    while (bufsz > 0) {
         int rc = rt_device_read(_rs485_dev, 0, buf + len, bufsz);
-        if (rc > 0) {
-            len += rc;
-            bufsz -= rc;
-            if (bufsz == 0) break;
+        if (rc <= 0) break;
 
-            continue;
-        }
-
-        if (rt_sem_take(_rx_notice, rt_tick_from_millisecond(timeout)) != RT_EOK) break;
+        len += rc;
+        bufsz -= rc;
     }
 
     return len;
 }
 
-int iap_process(void) {
-    static uint8_t _init_ok = 0;
-    static uint8_t _ctx_send_buf[AGILE_MODBUS_MAX_ADU_LENGTH];
-    static uint8_t _ctx_read_buf[5000];
-    static agile_modbus_rtu_t _ctx_rtu;
-    static int _remain_length = 0;
-
+int iap_init(void) {
     agile_modbus_t *ctx = &_ctx_rtu._ctx;
 
-    if (!_init_ok) {
-        if (rs485_init() != RT_EOK) return -RT_ERROR;
+    if (rs485_init() != RT_EOK) return -RT_ERROR;
 
-        agile_modbus_rtu_init(&_ctx_rtu, _ctx_send_buf, sizeof(_ctx_send_buf), _ctx_read_buf,
-                              sizeof(_ctx_read_buf));
-        agile_modbus_set_slave(ctx, 1);
-        agile_modbus_set_compute_meta_length_after_function_cb(
-            ctx, compute_meta_length_after_function_callback);
-        agile_modbus_set_compute_data_length_after_meta_cb(ctx,
-                                                           compute_data_length_after_meta_callback);
+    agile_modbus_rtu_init(&_ctx_rtu, _ctx_send_buf, sizeof(_ctx_send_buf), _ctx_read_buf,
+                          sizeof(_ctx_read_buf));
+    agile_modbus_set_slave(ctx, 1);
+    agile_modbus_set_compute_meta_length_after_function_cb(
+        ctx, compute_meta_length_after_function_callback);
+    agile_modbus_set_compute_data_length_after_meta_cb(ctx,
+                                                       compute_data_length_after_meta_callback);
 
-        _init_ok = 1;
-    }
+    return RT_EOK;
+}
+
+/* ticks until a partial frame in the buffer times out, RT_WAITING_FOREVER without one */
+rt_int32_t iap_timeout(void) {
+    if (_remain_length == 0) return RT_WAITING_FOREVER;
+
+    rt_tick_t passed = rt_tick_get() - _rx_tick;
+    rt_tick_t timeout = rt_tick_from_millisecond(RS485_FRAME_TIMEOUT);
+    if (passed >= timeout) return 0;
+
+    return timeout - passed;
+}
+
+int iap_process(void) {
+    agile_modbus_t *ctx = &_ctx_rtu._ctx;
+
+    if (_rs485_dev == RT_NULL) return -RT_ERROR;
 
     uint8_t tmp_buf[100];
-    int rt = rs485_receive(tmp_buf, sizeof(tmp_buf), 15);
+    int rt = rs485_receive(tmp_buf, sizeof(tmp_buf));
+    /* the uart may hold more than one read */
+    if (rt == sizeof(tmp_buf)) rt_event_send(&g_system.event, SYSTEM_EVENT_RS485_RX);
+    if (rt > 0) _rx_tick = rt_tick_get();
+
     int read_len = rt;
     if (rt > (ctx->read_bufsz - _remain_length)) read_len = ctx->read_bufsz - _remain_length;
 
@@ -118,7 +125,7 @@ int iap_process(void) {
     int total_len = read_len + _remain_length;
     int is_reset = 0;
 
-    if (total_len > 0 && read_len == 0) is_reset = 1;
+    if (total_len > 0 && read_len == 0 && iap_timeout() == 0) is_reset = 1;
 
     while (total_len > 0) {
         int frame_length = 0;
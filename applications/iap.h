@@ -1,6 +1,9 @@
 #ifndef __IAP_H
 #define __IAP_H
+#include <rtthread.h>
 
+int iap_init(void);
 int iap_process(void);
+rt_int32_t iap_timeout(void);
 
 #endif
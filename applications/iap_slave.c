@@ -252,7 +252,7 @@ int slave_callback(agile_modbus_t *ctx, struct agile_modbus_slave_info *slave_in
         } break;
 
         case IAP_CMD_UPDATE: {
-            g_system.is_quit = 1;
+            system_quit();
             _iap_step = IAP_STEP_UPDATE;
             ctx->send_buf[send_index++] = 0;
             ctx->send_buf[send_index++] = 0;
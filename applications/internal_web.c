@@ -4,8 +4,10 @@
 
 void internal_web_init(void) {
     extern const struct webnet_module_upload_entry upload_entry_firm;
+    extern void cgi_http_ota(struct webnet_session * session);
 
     webnet_upload_add(&upload_entry_firm);
+    webnet_cgi_register("ota", cgi_http_ota);
 
     webnet_init();
 }
@@ -9,16 +9,37 @@
 #define KEY_PIN            GET_PIN(F, 1)
 #define PRESS_DOWN_TIMEOUT 100
 
-int key_process(void) {
-    static uint8_t _init_ok = 0;
-    static rt_tick_t tick_timeout = 0;
-    static int pre_state = PIN_HIGH;
+static rt_tick_t tick_timeout = 0;
+static int pre_state = PIN_HIGH;
+
+static void key_irq(void *args) { rt_event_send(&g_system.event, SYSTEM_EVENT_KEY); }
+
+int key_init(void) {
+    rt_pin_mode(KEY_PIN, PIN_MODE_INPUT_PULLUP);
+    rt_pin_attach_irq(KEY_PIN, PIN_IRQ_MODE_FALLING, key_irq, RT_NULL);
+    rt_pin_irq_enable(KEY_PIN, PIN_IRQ_ENABLE);
 
-    if (!_init_ok) {
-        rt_pin_mode(KEY_PIN, PIN_MODE_INPUT_PULLUP);
-        _init_ok = 1;
+    /* a key held since reset never gives a falling edge, start its hold time here */
+    if (rt_pin_read(KEY_PIN) == PIN_LOW) {
+        tick_timeout = rt_tick_get() + rt_tick_from_millisecond(PRESS_DOWN_TIMEOUT);
+        pre_state = PIN_LOW;
+        rt_event_send(&g_system.event, SYSTEM_EVENT_KEY);
     }
 
+    return RT_EOK;
+}
+
+/* ticks until a held key counts as pressed, RT_WAITING_FOREVER when released */
+rt_int32_t key_timeout(void) {
+    if (g_system.is_remain || (pre_state == PIN_HIGH)) return RT_WAITING_FOREVER;
+
+    rt_tick_t left = tick_timeout - rt_tick_get();
+    if (left >= (RT_TICK_MAX / 2)) return 0;
+
+    return left;
+}
+
+int key_process(void) {
     int state = rt_pin_read(KEY_PIN);
     if (state == PIN_LOW) {
         if (pre_state == PIN_HIGH) {
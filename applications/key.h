@@ -1,6 +1,9 @@
 #ifndef __KEY_H
 #define __KEY_H
+#include <rtthread.h>
 
+int key_init(void);
 int key_process(void);
+rt_int32_t key_timeout(void);
 
 #endif
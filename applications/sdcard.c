@@ -1,6 +1,16 @@
 #include <rtthread.h>
+#include <rtdevice.h>
+#include "hpm_l1c_drv.h"
+#ifdef BSP_SDXC_USING_NATIVE
+#include "hpm_sdmmc_disk.h"
+#else
+#include "ff.h"
+/* ff.h has its own DIR, as in dfs_elm.c */
+#define HAVE_DIR_STRUCTURE
 #include <dfs_fs.h>
+#include <dfs_file.h>
 #include <unistd.h>
+#endif
 #include "sdcard.h"
 #include "boot.h"
 
@@ -8,20 +18,41 @@
 #define DBG_LVL DBG_LOG
 #include <rtdbg.h>
 
+#ifdef BSP_SDXC_USING_NATIVE
+/* the SDK fatfs numbers its volumes after the physical drive, DEV_SD in diskio.h */
+#define SDCARD_ROOT        "3:"
+#define SDCARD_FIRM_PATH   "3:/rtthread.rbl"
+#else
 #define SDCARD_DEVICE_NAME "sd0"
 #define SDCARD_ROOT        "/sdcard"
 #define SDCARD_FIRM_PATH   "/sdcard/rtthread.rbl"
+#endif
+#define SDCARD_SECTOR_SIZE 512
+
+#define SDCARD_CHECK_STACK_SIZE   2048
+#define SDCARD_CHECK_PRIORITY     (RT_MAIN_THREAD_PRIORITY + 1)
+
+#define SDCARD_PIPE_BUF_SIZE      (64 * 1024)
+#define SDCARD_PIPE_BUF_NUM       3
+#define SDCARD_READ_STACK_SIZE    2048
+/* above the main thread, so the next read is queued as soon as a flash write lets go */
+#define SDCARD_READ_PRIORITY      (RT_MAIN_THREAD_PRIORITY - 1)
+#define SDCARD_PROGRESS_INTERVAL  500 /* ms */
+#define SDCARD_DETECT_INTERVAL    100 /* ms, native backend card detect poll */
 
 enum {
     SDCARD_CHECK_STEP_NULL = 0,
     SDCARD_CHECK_STEP_FIND,
+    SDCARD_CHECK_STEP_MOUNT,
     SDCARD_CHECK_STEP_SUCCESS,
     SDCARD_CHECK_STEP_FAIL,
 };
 
 #define FIRM_BUF_SIZE 4096
-static uint8_t _firm_buf[FIRM_BUF_SIZE];
-static uint8_t _check_step = SDCARD_CHECK_STEP_FIND;
+/* cache line aligned, the native backend has the card DMA into it */
+ATTR_ALIGN(HPM_L1C_CACHELINE_SIZE) static uint8_t _firm_buf[FIRM_BUF_SIZE];
+static volatile uint8_t _check_step = SDCARD_CHECK_STEP_NULL;
+static rt_tick_t _check_tick; /* when the card check started, first reads are timed from it */
 
 static void print_progress(size_t cur_size, size_t total_size) {
     static uint8_t progress_sign[100 + 1];
@@ -47,12 +78,154 @@ static void print_progress(size_t cur_size, size_t total_size) {
     LOG_I("OTA Write: [%s] %d%%", progress_sign, per);
 }
 
-int sdcard_update(void) {
-    const struct fal_partition *download_part = g_system.download_part;
-    int rc = RT_EOK, ret = RT_EOK;
+/* the firmware file, read through the file system or straight from the card */
+typedef struct {
+#ifdef BSP_SDXC_USING_NATIVE
+    FIL *fp;
+#else
+    int fd;
+#endif
+    uint32_t size;
+    uint32_t pos;    /* file offset of the next read */
+#ifndef BSP_SDXC_USING_NATIVE
+    rt_device_t dev; /* set when the file is one cluster run, see sdcard_file_extent() */
+    uint32_t sector; /* first sector of the file on dev */
+#endif
+} sdcard_file_t;
+
+#ifndef BSP_SDXC_USING_NATIVE
+
+/* one buffer of the sd -> flash pipeline */
+typedef struct {
+    uint8_t *buf;
+    uint32_t size;
+    uint8_t *data; /* where the bytes read start in buf */
+    int length;    /* bytes read, 0 at the end of the copy, < 0 on a read error */
+} sdcard_slot_t;
+
+/* the reader thread fills slots from the card while the caller programs the flash */
+typedef struct {
+    sdcard_file_t *file;
+    uint32_t length; /* bytes to copy from the current file position */
+    int slot_num;
+    sdcard_slot_t slot[SDCARD_PIPE_BUF_NUM];
+    struct rt_mailbox free_mb; /* slots the reader may fill */
+    struct rt_mailbox full_mb; /* slots the writer has to program */
+    rt_ubase_t free_pool[SDCARD_PIPE_BUF_NUM];
+    rt_ubase_t full_pool[SDCARD_PIPE_BUF_NUM];
+    volatile int abort;
+} sdcard_pipe_t;
+
+static sdcard_pipe_t _pipe;
+#endif
+
+#ifdef BSP_SDXC_USING_NATIVE
+/* fatfs windows are read by the card DMA, keep them out of the cache like g_sd */
+ATTR_PLACE_AT_NONCACHEABLE_BSS static FATFS _fs;
+ATTR_PLACE_AT_NONCACHEABLE_BSS static FIL _fil; /* the only file this backend opens */
+
+static int sdcard_file_open(sdcard_file_t *file) {
+    FRESULT res;
+
+    rt_memset(file, 0, sizeof(sdcard_file_t));
+
+    if (_check_step != SDCARD_CHECK_STEP_SUCCESS) {
+        LOG_W("sdcard is not checked success.");
+        return -RT_ERROR;
+    }
+
+    res = f_open(&_fil, SDCARD_FIRM_PATH, FA_READ);
+    if (res != FR_OK) {
+        LOG_W("open %s file failed(%d).", SDCARD_FIRM_PATH, res);
+        return -RT_ERROR;
+    }
+
+    if (f_size(&_fil) == 0) {
+        LOG_W("[update] %s is a empty file.", SDCARD_FIRM_PATH);
+        f_close(&_fil);
+        return -RT_ERROR;
+    }
+
+    file->fp = &_fil;
+    file->size = f_size(&_fil);
+    LOG_I("firm file %s size: %d", SDCARD_FIRM_PATH, file->size);
+
+    return RT_EOK;
+}
+
+static void sdcard_file_close(sdcard_file_t *file) { f_close(file->fp); }
+
+static int sdcard_file_seek(sdcard_file_t *file, uint32_t pos) {
+    if ((pos > file->size) || (f_lseek(file->fp, pos) != FR_OK)) return -RT_ERROR;
+
+    file->pos = pos;
+    return RT_EOK;
+}
+
+/* whole sectors go from the card straight into buf, a cluster per command */
+static int sdcard_file_do_read(sdcard_file_t *file, uint8_t *buf, uint32_t size, uint8_t **data) {
+    UINT length = 0;
+
+    if (f_read(file->fp, buf, size, &length) != FR_OK) return -RT_ERROR;
+
+    *data = buf;
+    file->pos += length;
+    return length;
+}
+#else
+
+/* first sector of the file if FatFs keeps it in a single cluster run */
+static int sdcard_file_extent(int fd, uint32_t size, uint32_t *sector) {
+    struct dfs_fd *d = fd_get(fd);
+    DWORD clmt[4]; /* table size, one fragment (clusters, first cluster), terminator */
+    FRESULT res;
+
+    if (d == RT_NULL) return -RT_ERROR;
+
+    FIL *fp = (FIL *)d->data;
+    FATFS *fs = fp->obj.fs;
+
+    clmt[0] = sizeof(clmt) / sizeof(clmt[0]);
+    fp->cltbl = clmt;
+    res = f_lseek(fp, CREATE_LINKMAP);
+    fp->cltbl = RT_NULL;
+    fd_put(d);
+
+    if (res == FR_NOT_ENOUGH_CORE) {
+        LOG_I("%s is fragmented, read through the file system.", SDCARD_FIRM_PATH);
+        return -RT_ERROR;
+    }
+    if (res != FR_OK) return -RT_ERROR;
+
+    DWORD ncl = clmt[1], clst = clmt[2];
+    if ((clst < 2) || (clst + ncl > fs->n_fatent) ||
+        ((uint64_t)ncl * fs->csize * SDCARD_SECTOR_SIZE < size)) {
+        LOG_W("%s cluster run %u+%u is invalid.", SDCARD_FIRM_PATH, clst, ncl);
+        return -RT_ERROR;
+    }
+
+    *sector = fs->database + (clst - 2) * fs->csize;
+    return RT_EOK;
+}
+
+static int sdcard_read_full(int fd, uint8_t *buf, uint32_t size) {
+    uint32_t total = 0;
+
+    while (total < size) {
+        int length = read(fd, buf + total, size - total);
+        if (length < 0) return length;
+        if (length == 0) break;
+        total += length;
+    }
+
+    return total;
+}
+
+static int sdcard_file_open(sdcard_file_t *file) {
     struct stat s = {0};
-    uint32_t total_length = 0;
-    int length = 0;
+    struct rt_device_blk_geometry geometry = {0};
+
+    rt_memset(file, 0, sizeof(sdcard_file_t));
 
     if (_check_step != SDCARD_CHECK_STEP_SUCCESS) {
         LOG_W("sdcard is not checked success.");
@@ -69,88 +242,527 @@ int sdcard_update(void) {
         return -RT_ERROR;
     }
 
-    if (s.st_size > download_part->len) {
-        LOG_W("firm size (%d) is greater than (%d)", s.st_size, download_part->len);
-        return -RT_ERROR;
-    }
-
     LOG_I("firm file %s size: %d", SDCARD_FIRM_PATH, s.st_size);
 
-    int fd = open(SDCARD_FIRM_PATH, O_RDONLY);
-    if (fd < 0) {
+    file->fd = open(SDCARD_FIRM_PATH, O_RDONLY);
+    if (file->fd < 0) {
         LOG_W("open %s file failed.", SDCARD_FIRM_PATH);
         return -RT_ERROR;
     }
+    file->size = s.st_size;
+
+    /* the raw path reads the device the volume is mounted on, in whole sectors */
+    rt_device_t dev = rt_device_find(SDCARD_DEVICE_NAME);
+    if ((dev != RT_NULL) && (sdcard_file_extent(file->fd, file->size, &file->sector) == RT_EOK) &&
+        (rt_device_control(dev, RT_DEVICE_CTRL_BLK_GETGEOME, &geometry) == RT_EOK) &&
+        (geometry.bytes_per_sector == SDCARD_SECTOR_SIZE) &&
+        (file->sector + (file->size + SDCARD_SECTOR_SIZE - 1) / SDCARD_SECTOR_SIZE <=
+         geometry.sector_count) &&
+        (rt_device_open(dev, RT_DEVICE_OFLAG_RDONLY) == RT_EOK)) {
+        LOG_I("%s is contiguous from sector %u, read raw.", SDCARD_FIRM_PATH, file->sector);
+        file->dev = dev;
+    }
+
+    return RT_EOK;
+}
+
+static void sdcard_file_close(sdcard_file_t *file) {
+    if (file->dev != RT_NULL) rt_device_close(file->dev);
+    close(file->fd);
+}
+
+static int sdcard_file_seek(sdcard_file_t *file, uint32_t pos) {
+    if (pos > file->size) return -RT_ERROR;
+    if ((file->dev == RT_NULL) && (lseek(file->fd, pos, SEEK_SET) != pos)) return -RT_ERROR;
+
+    file->pos = pos;
+    return RT_EOK;
+}
+
+/* raw reads keep to the sector grid, *data is where the bytes start in buf */
+static int sdcard_file_do_read(sdcard_file_t *file, uint8_t *buf, uint32_t size, uint8_t **data) {
+    int length;
+
+    /* the last pipe call asks for nothing, that and the end of the file are not errors */
+    if ((size == 0) || (file->pos >= file->size)) return 0;
+
+    if (file->dev == RT_NULL) {
+        *data = buf;
+        length = sdcard_read_full(file->fd, buf, size);
+    } else {
+        uint32_t skip = file->pos % SDCARD_SECTOR_SIZE;
+        if (size <= skip) return -RT_ERROR;
+
+        length = size - skip;
+        if (length > file->size - file->pos) length = file->size - file->pos;
+        if (length == 0) return 0;
+
+        rt_size_t count = (skip + length + SDCARD_SECTOR_SIZE - 1) / SDCARD_SECTOR_SIZE;
+        if (rt_device_read(file->dev, file->sector + file->pos / SDCARD_SECTOR_SIZE, buf, count) !=
+            count)
+            return -RT_ERROR;
+        *data = buf + skip;
+    }
+
+    if (length > 0) file->pos += length;
+    return length;
+}
+#endif
+
+/* read up to size bytes into buf, the first read after boot is timed from the card check */
+static int sdcard_file_read(sdcard_file_t *file, uint8_t *buf, uint32_t size, uint8_t **data) {
+    static uint8_t timed = 0;
+    int length = sdcard_file_do_read(file, buf, size, data);
+
+    if (!timed && (length > 0)) {
+        timed = 1;
+        LOG_I("first %d bytes of %s in %u ms from the card check.", length, SDCARD_FIRM_PATH,
+              (rt_tick_get() - _check_tick) * 1000 / RT_TICK_PER_SECOND);
+    }
+
+    return length;
+}
+
+static void *sdcard_buf_alloc(uint32_t *size) {
+    void *buf = rt_malloc_align(SDCARD_PIPE_BUF_SIZE, HPM_L1C_CACHELINE_SIZE);
+
+    *size = (buf != RT_NULL) ? SDCARD_PIPE_BUF_SIZE : FIRM_BUF_SIZE;
+    return (buf != RT_NULL) ? buf : _firm_buf;
+}
+
+static void sdcard_buf_free(void *buf) {
+    if (buf != _firm_buf) rt_free_align(buf);
+}
+
+#ifndef BSP_SDXC_USING_NATIVE
+static void sdcard_read_entry(void *parameter) {
+    sdcard_pipe_t *pipe = parameter;
+    uint32_t total_length = 0;
+    sdcard_slot_t *slot;
 
-    ret = -RT_ERROR;
     do {
-        LOG_I("The partition \'%s\' is erasing.", download_part->name);
+        rt_mb_recv(&pipe->free_mb, (rt_ubase_t *)&slot, RT_WAITING_FOREVER);
+
+        if (pipe->abort) {
+            slot->length = 0;
+        } else {
+            uint32_t size = pipe->length - total_length;
+            if (size > slot->size) size = slot->size;
+            slot->length = sdcard_file_read(pipe->file, slot->buf, size, &slot->data);
+            if (slot->length > 0) total_length += slot->length;
+        }
+
+        rt_mb_send(&pipe->full_mb, (rt_ubase_t)slot);
+    } while (slot->length > 0);
+}
+
+static int sdcard_pipe_init(sdcard_pipe_t *pipe, sdcard_file_t *file, uint32_t length) {
+    rt_memset(pipe, 0, sizeof(sdcard_pipe_t));
+    pipe->file = file;
+    pipe->length = length;
+
+    for (int i = 0; i < SDCARD_PIPE_BUF_NUM; i++) {
+        pipe->slot[i].buf = rt_malloc(SDCARD_PIPE_BUF_SIZE);
+        if (pipe->slot[i].buf == RT_NULL) break;
+        pipe->slot[i].size = SDCARD_PIPE_BUF_SIZE;
+        pipe->slot_num++;
+    }
+
+    if (pipe->slot_num == 0) {
+        LOG_W("no memory for pipe buffers, copy with %d bytes.", FIRM_BUF_SIZE);
+        pipe->slot[0].buf = _firm_buf;
+        pipe->slot[0].size = FIRM_BUF_SIZE;
+        pipe->slot_num = 1;
+    }
+
+    rt_mb_init(&pipe->free_mb, "sd_free", pipe->free_pool, SDCARD_PIPE_BUF_NUM, RT_IPC_FLAG_FIFO);
+    rt_mb_init(&pipe->full_mb, "sd_full", pipe->full_pool, SDCARD_PIPE_BUF_NUM, RT_IPC_FLAG_FIFO);
+    for (int i = 0; i < pipe->slot_num; i++) rt_mb_send(&pipe->free_mb, (rt_ubase_t)&pipe->slot[i]);
+
+    return pipe->slot_num;
+}
+
+static void sdcard_pipe_deinit(sdcard_pipe_t *pipe) {
+    for (int i = 0; i < pipe->slot_num; i++) {
+        if (pipe->slot[i].buf != _firm_buf) rt_free(pipe->slot[i].buf);
+    }
+    rt_mb_detach(&pipe->free_mb);
+    rt_mb_detach(&pipe->full_mb);
+}
+
+/* program the flash from the full slots until the reader hands over its last one */
+static int sdcard_pipe_write(sdcard_pipe_t *pipe, const struct fal_partition *part,
+                             uint32_t part_off) {
+    uint32_t total_length = 0;
+    rt_tick_t progress_tick = rt_tick_get();
+    sdcard_slot_t *slot;
+
+    do {
+        rt_mb_recv(&pipe->full_mb, (rt_ubase_t *)&slot, RT_WAITING_FOREVER);
+
+        if ((slot->length > 0) && !pipe->abort) {
+            if (fal_partition_write(part, part_off + total_length, slot->data, slot->length) <= 0) {
+                LOG_E("write \'%s\' at %d failed.", part->name, part_off + total_length);
+                pipe->abort = 1;
+            } else {
+                total_length += slot->length;
+                if ((total_length == pipe->length) ||
+                    (rt_tick_get() - progress_tick >= rt_tick_from_millisecond(SDCARD_PROGRESS_INTERVAL))) {
+                    progress_tick = rt_tick_get();
+                    print_progress(total_length, pipe->length);
+                }
+            }
+        }
+
+        if (slot->length <= 0) break;
+        rt_mb_send(&pipe->free_mb, (rt_ubase_t)slot);
+    } while (1);
+
+    if (slot->length < 0) LOG_E("read %s at %d failed.", SDCARD_FIRM_PATH, total_length);
+
+    return (total_length == pipe->length) ? RT_EOK : -RT_ERROR;
+}
+
+/* copy length bytes from the current position of file to part at part_off */
+static int sdcard_copy(sdcard_file_t *file, const struct fal_partition *part, uint32_t part_off,
+                       uint32_t length) {
+    int ret = -RT_ERROR;
+    rt_tick_t tick = rt_tick_get();
+
+    sdcard_pipe_init(&_pipe, file, length);
+    rt_thread_t tid = rt_thread_create("sd_read", sdcard_read_entry, &_pipe,
+                                       SDCARD_READ_STACK_SIZE, SDCARD_READ_PRIORITY, 10);
+    if (tid != RT_NULL) {
+        rt_thread_startup(tid);
+        ret = sdcard_pipe_write(&_pipe, part, part_off);
+    } else {
+        LOG_E("create read thread failed.");
+    }
+    sdcard_pipe_deinit(&_pipe);
+
+    if (ret == RT_EOK)
+        LOG_I("copy %d bytes in %u ms, %d x %d bytes buffers, %s read.", length,
+              (rt_tick_get() - tick) * 1000 / RT_TICK_PER_SECOND, _pipe.slot_num,
+              _pipe.slot[0].size, (file->dev != RT_NULL) ? "raw" : "file");
+
+    return ret;
+}
+#else
+/* no reader thread, read a buffer and program it in turn */
+static int sdcard_copy(sdcard_file_t *file, const struct fal_partition *part, uint32_t part_off,
+                       uint32_t length) {
+    uint32_t buf_size, total_length = 0;
+    uint8_t *buf = sdcard_buf_alloc(&buf_size);
+    uint8_t *data;
+    rt_tick_t tick = rt_tick_get(), progress_tick = tick;
+
+    while (total_length < length) {
+        uint32_t size = length - total_length;
+        if (size > buf_size) size = buf_size;
+
+        int read_length = sdcard_file_read(file, buf, size, &data);
+        if (read_length <= 0) {
+            LOG_E("read %s at %d failed.", SDCARD_FIRM_PATH, total_length);
+            break;
+        }
+
+        if (fal_partition_write(part, part_off + total_length, data, read_length) <= 0) {
+            LOG_E("write \'%s\' at %d failed.", part->name, part_off + total_length);
+            break;
+        }
+
+        total_length += read_length;
+        if ((total_length == length) ||
+            (rt_tick_get() - progress_tick >= rt_tick_from_millisecond(SDCARD_PROGRESS_INTERVAL))) {
+            progress_tick = rt_tick_get();
+            print_progress(total_length, length);
+        }
+    }
 
-        rc = fal_partition_erase_all(download_part);
+    sdcard_buf_free(buf);
 
-        if (rc < 0) break;
+    if (total_length != length) return -RT_ERROR;
+
+    LOG_I("copy %d bytes in %u ms, %d bytes buffer, native read.", length,
+          (rt_tick_get() - tick) * 1000 / RT_TICK_PER_SECOND, buf_size);
+    return RT_EOK;
+}
+#endif
+
+int sdcard_update(void) {
+    const struct fal_partition *download_part = g_system.download_part;
+    sdcard_file_t file;
+    int ret = -RT_ERROR;
+
+    if (sdcard_file_open(&file) != RT_EOK) return -RT_ERROR;
+
+    do {
+        if (file.size > download_part->len) {
+            LOG_W("firm size (%d) is greater than (%d)", file.size, download_part->len);
+            break;
+        }
+
+        LOG_I("The partition \'%s\' is erasing.", download_part->name);
+        if (fal_partition_erase_all(download_part) < 0) break;
         LOG_I("The partition \'%s\' erase success.", download_part->name);
 
-        do {
-            length = read(fd, _firm_buf,
-                          s.st_size - total_length > FIRM_BUF_SIZE ? FIRM_BUF_SIZE
-                                                                   : s.st_size - total_length);
-            if (length <= 0) break;
+        ret = sdcard_copy(&file, download_part, 0, file.size);
+    } while (0);
+
+    sdcard_file_close(&file);
+
+    return ret;
+}
+
+/* header and body crc of the package on the card, read once before any flash is touched */
+static int sdcard_verify(sdcard_file_t *file, firm_pkg_t *header) {
+    static firm_verify_t verify;
+    uint32_t buf_size;
+    uint8_t *buf = sdcard_buf_alloc(&buf_size);
+    uint8_t *data;
+    int length, rc = RT_EOK;
+
+    firm_verify_init(&verify, SDCARD_FIRM_PATH);
+    do {
+        length = sdcard_file_read(file, buf, buf_size, &data);
+        if (length > 0) rc = firm_verify_update(&verify, data, length);
+    } while ((length > 0) && (rc == RT_EOK));
+
+    sdcard_buf_free(buf);
+
+    if (length < 0) {
+        LOG_E("read %s failed.", SDCARD_FIRM_PATH);
+        return -RT_ERROR;
+    }
+    if ((rc != RT_EOK) || (firm_verify_final(&verify) != RT_EOK)) return -RT_ERROR;
+
+    *header = verify.header;
+    return RT_EOK;
+}
+
+int sdcard_install(void) {
+    const struct fal_partition *app_part = g_system.app_part;
+    firm_pkg_t header = {0}, app_header = {0};
+    sdcard_file_t file;
+    int ret = -RT_ERROR;
+
+    if (sdcard_file_open(&file) != RT_EOK) return -RT_ERROR;
+
+    do {
+        if (sdcard_verify(&file, &header) != RT_EOK) break;
+
+        if ((header.raw_size + sizeof(firm_pkg_t)) > app_part->len) {
+            LOG_W("The partition \'%s\' length is (%d), need (%d)!", app_part->name, app_part->len,
+                  header.raw_size + sizeof(firm_pkg_t));
+            break;
+        }
+
+        if (sdcard_file_seek(&file, sizeof(firm_pkg_t)) != RT_EOK) {
+            LOG_E("seek %s failed.", SDCARD_FIRM_PATH);
+            break;
+        }
+
+        LOG_I("OTA firmware(%s) install(%s) from %s startup.", app_part->name, header.version_name,
+              SDCARD_FIRM_PATH);
+
+        /* from here on the app is gone until the header is written */
+        ret = -RT_EIO;
 
-            rc = fal_partition_write(download_part, total_length, _firm_buf, length);
-            if (rc <= 0) break;
+        LOG_I("The partition \'%s\' is erasing.", app_part->name);
+        if (fal_partition_erase_all(app_part) < 0) break;
+        LOG_I("The partition \'%s\' erase success.", app_part->name);
 
-            total_length += length;
-            print_progress(total_length, s.st_size);
-        } while (total_length < s.st_size);
+        if (sdcard_copy(&file, app_part, 0, header.raw_size) != RT_EOK) break;
 
-        if (total_length < s.st_size) break;
+        if (fal_partition_write(app_part, app_part->len - sizeof(firm_pkg_t), (uint8_t *)&header,
+                                sizeof(firm_pkg_t)) < 0)
+            break;
+
+        if (check_part_firm(app_part, &app_header) != RT_EOK) break;
 
         ret = RT_EOK;
     } while (0);
 
-    close(fd);
+    sdcard_file_close(&file);
 
     return ret;
 }
 
+#ifdef BSP_SDXC_USING_NATIVE
+/* the card is in, bring it up and mount it in place */
+static void sdcard_find(void) {
+    FILINFO info;
+
+    _check_step = SDCARD_CHECK_STEP_MOUNT;
+    FRESULT res = f_mount(&_fs, SDCARD_ROOT, 1);
+    if (res == FR_OK) {
+        LOG_I("sd card mount to '%s' in %u ms", SDCARD_ROOT,
+              (rt_tick_get() - _check_tick) * 1000 / RT_TICK_PER_SECOND);
+
+        do {
+            if (f_stat(SDCARD_FIRM_PATH, &info) != FR_OK) {
+                LOG_W("[check] get file %s information failed.", SDCARD_FIRM_PATH);
+                break;
+            }
+
+            if (info.fsize == 0) {
+                LOG_W("[check] %s is a empty file.", SDCARD_FIRM_PATH);
+                break;
+            }
+
+            _check_step = SDCARD_CHECK_STEP_SUCCESS;
+            rt_event_send(&g_system.event, SYSTEM_EVENT_SDCARD);
+            return;
+        } while (0);
+    } else {
+        LOG_W("sd card mount to '%s' failed(%d)!", SDCARD_ROOT, res);
+    }
+
+    _check_step = SDCARD_CHECK_STEP_FAIL;
+    rt_event_send(&g_system.event, SYSTEM_EVENT_SDCARD);
+}
+
+/* the main loop may sleep with no deadline, a card put in later has to wake it */
+static struct rt_timer _detect_timer;
+
+static void sdcard_detect_timeout(void *parameter) {
+    if (sd_is_card_present(&g_sd)) rt_event_send(&g_system.event, SYSTEM_EVENT_SDCARD);
+}
+
+/* no threads, the card is brought up from the main loop once the detect timer sees it */
 int sdcard_check(void) {
     switch (_check_step) {
-        case SDCARD_CHECK_STEP_FIND: {
-            rt_device_t dev = rt_device_find(SDCARD_DEVICE_NAME);
-            if (dev == RT_NULL) break;
+        case SDCARD_CHECK_STEP_NULL:
+            _check_tick = rt_tick_get();
+            if (sd_host_init(&g_sd) != status_success) {
+                LOG_E("sd host init failed.");
+                _check_step = SDCARD_CHECK_STEP_FAIL;
+                break;
+            }
+            _check_step = SDCARD_CHECK_STEP_FIND;
+            rt_timer_init(&_detect_timer, "sd_cd", sdcard_detect_timeout, RT_NULL,
+                          rt_tick_from_millisecond(SDCARD_DETECT_INTERVAL), RT_TIMER_FLAG_PERIODIC);
+            rt_timer_start(&_detect_timer);
+            /* fall through */
+
+        case SDCARD_CHECK_STEP_FIND:
+            /* sd_init() spins until a card shows up, only go there with one in */
+            if (sd_is_card_present(&g_sd)) {
+                rt_timer_stop(&_detect_timer);
+                sdcard_find();
+            }
+            break;
 
-            int rc = dfs_mount(SDCARD_DEVICE_NAME, SDCARD_ROOT, "elm", 0, 0);
-            if (rc == RT_EOK) {
-                LOG_I("sd card mount to '%s'", SDCARD_ROOT);
+        default:
+            break;
+    }
 
-                _check_step = SDCARD_CHECK_STEP_FAIL;
-                do {
-                    struct stat s = {0};
-                    if (stat(SDCARD_FIRM_PATH, &s) != 0) {
-                        LOG_W("[check] get file %s information failed.", SDCARD_FIRM_PATH);
-                        break;
-                    }
-
-                    if (s.st_size <= 0) {
-                        LOG_W("[check] %s is a empty file.", SDCARD_FIRM_PATH);
-                        break;
-                    }
-
-                    _check_step = SDCARD_CHECK_STEP_SUCCESS;
-                } while (0);
+    return (_check_step == SDCARD_CHECK_STEP_SUCCESS) ? RT_EOK : -RT_ERROR;
+}
+#else
+static void sdcard_find(void) {
+    rt_device_t dev = rt_device_find(SDCARD_DEVICE_NAME);
+    if (dev == RT_NULL) return;
+
+    _check_step = SDCARD_CHECK_STEP_MOUNT;
+    int rc = dfs_mount(SDCARD_DEVICE_NAME, SDCARD_ROOT, "elm", 0, 0);
+    if (rc == RT_EOK) {
+        LOG_I("sd card mount to '%s'", SDCARD_ROOT);
+
+        do {
+            struct stat s = {0};
+            if (stat(SDCARD_FIRM_PATH, &s) != 0) {
+                LOG_W("[check] get file %s information failed.", SDCARD_FIRM_PATH);
+                break;
+            }
+
+            if (s.st_size <= 0) {
+                LOG_W("[check] %s is a empty file.", SDCARD_FIRM_PATH);
+                break;
+            }
+
+            _check_step = SDCARD_CHECK_STEP_SUCCESS;
+            rt_event_send(&g_system.event, SYSTEM_EVENT_SDCARD);
+            return;
+        } while (0);
+    } else {
+        LOG_W("sd card mount to '%s' failed!", SDCARD_ROOT);
+    }
+
+    _check_step = SDCARD_CHECK_STEP_FAIL;
+    rt_event_send(&g_system.event, SYSTEM_EVENT_SDCARD);
+}
+
+/* card detection and mount run here, rs485 and the network keep going meanwhile */
+static void sdcard_check_entry(void *parameter) {
+    /* the sdio detect thread reports each card it brought up, none comes without a card */
+    while (rt_device_find(SDCARD_DEVICE_NAME) == RT_NULL) {
+        mmcsd_wait_cd_changed(RT_WAITING_FOREVER);
+    }
+
+    sdcard_find();
+}
+
+int sdcard_check(void) {
+    static rt_thread_t tid = RT_NULL;
+
+    switch (_check_step) {
+        case SDCARD_CHECK_STEP_NULL: {
+            _check_tick = rt_tick_get();
+            _check_step = SDCARD_CHECK_STEP_FIND;
+            tid = rt_thread_create("sd_chk", sdcard_check_entry, RT_NULL, SDCARD_CHECK_STACK_SIZE,
+                                   SDCARD_CHECK_PRIORITY, 10);
+            if (tid != RT_NULL) {
+                rt_thread_startup(tid);
             } else {
-                LOG_W("sd card mount to '%s' failed!", SDCARD_ROOT);
-                _check_step = SDCARD_CHECK_STEP_FAIL;
+                LOG_W("create check thread failed, check in place.");
             }
         } break;
 
-        case SDCARD_CHECK_STEP_SUCCESS:
-            return RT_EOK;
+        case SDCARD_CHECK_STEP_FIND:
+            if (tid == RT_NULL) sdcard_find();
+            break;
 
         default:
             break;
     }
 
-    return -RT_ERROR;
+    return (_check_step == SDCARD_CHECK_STEP_SUCCESS) ? RT_EOK : -RT_ERROR;
+}
+#endif
+
+/* the card is there and being mounted or checked */
+int sdcard_checking(void) { return _check_step == SDCARD_CHECK_STEP_MOUNT; }
+
+/* read the whole firmware file without touching the flash, to compare the sd backends */
+static void sdcard_bench(int argc, char **argv) {
+    sdcard_file_t file;
+    uint32_t buf_size, total_length = 0;
+    uint8_t *buf, *data;
+    int length;
+
+    if (sdcard_file_open(&file) != RT_EOK) return;
+
+    buf = sdcard_buf_alloc(&buf_size);
+    rt_tick_t tick = rt_tick_get();
+    do {
+        length = sdcard_file_read(&file, buf, buf_size, &data);
+        if (length > 0) total_length += length;
+    } while (length > 0);
+    uint32_t ms = (rt_tick_get() - tick) * 1000 / RT_TICK_PER_SECOND;
+    sdcard_buf_free(buf);
+    sdcard_file_close(&file);
+
+    if (length < 0) {
+        rt_kprintf("read %s failed at %u.\n", SDCARD_FIRM_PATH, total_length);
+        return;
+    }
+    rt_kprintf("%s: %u bytes in %u ms, %u KB/s, %u bytes buffer, %s read\n", SDCARD_FIRM_PATH,
+               total_length, ms, (ms > 0) ? (total_length / ms * 1000 / 1024) : 0, buf_size,
+#ifdef BSP_SDXC_USING_NATIVE
+               "native");
+#else
+               (file.dev != RT_NULL) ? "raw" : "file");
+#endif
 }
+MSH_CMD_EXPORT(sdcard_bench, read the firmware file on the sd card and time it);
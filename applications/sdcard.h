@@ -2,6 +2,9 @@
 #define __SDCARD_H
 
 int sdcard_check(void);
+int sdcard_checking(void);
 int sdcard_update(void);
+/* -RT_EIO: the app partition was touched and is no longer valid */
+int sdcard_install(void);
 
 #endif
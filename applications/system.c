@@ -4,21 +4,129 @@
 #include <rthw.h>
 #include <dfs_fs.h>
 #include <dfs_romfs.h>
+#ifdef RT_USING_WIFI
 #include <wlan_mgnt.h>
+#endif
+#ifdef BSP_USING_ETH
+/* lwip first, netdev.h takes its ip_addr_t, like ethernetif.c */
+#include "drv_enet.h"
+#include <lwip/inet.h>
+#include <netdev.h>
+#ifdef RT_USING_PHY
+#include "eth_phy_port.h"
+#endif
+#endif
 #include "iap.h"
 #include "sdcard.h"
 #include "internal_web.h"
+#include "tftp_server.h"
 #include "key.h"
 
 #define DBG_TAG "system"
 #define DBG_LVL DBG_LOG
 #include <rtdbg.h>
 
+#ifdef BSP_USING_ETH
+/* lwip names the netif after the first two letters of the ENET device name */
+#define ETH_NETDEV_NAME "ET"
+#endif
+
+#define BRINGUP_THREAD_STACK_SIZE 2048
+#define BRINGUP_THREAD_PRIORITY   (RT_MAIN_THREAD_PRIORITY + 1)
+
 extern int wifi_spi_device_init(void);
 
 g_system_t g_system = {0};
 
+/* the transport writing the app/download partitions, one at a time */
+static const char *_update_owner = RT_NULL;
+
+#ifdef BSP_USING_ETH
+/* ENET is left alone until boot mode is entered, the jump to the app does not wait
+ * on the PHY or send DHCP. The update services listen on INADDR_ANY and answer on
+ * the netif as soon as the PHY reports the link. */
+static void eth_network_init(void) {
+#ifdef RT_USING_PHY
+    phy_device_register();
+#endif
+    if (rt_hw_eth_init() != RT_EOK) {
+        LOG_E("ethernet init failed.");
+        return;
+    }
+
+    struct netdev *netdev = netdev_get_by_name(ETH_NETDEV_NAME);
+    if (netdev == RT_NULL) {
+        LOG_W("netdev '%s' not find.", ETH_NETDEV_NAME);
+        return;
+    }
+
+#ifdef BSP_ETH_USING_STATIC_IP
+    ip_addr_t addr;
+
+    netdev_dhcp_enabled(netdev, RT_FALSE);
+    inet_aton(RT_LWIP_IPADDR, &addr);
+    netdev_set_ipaddr(netdev, &addr);
+    inet_aton(RT_LWIP_GWADDR, &addr);
+    netdev_set_gw(netdev, &addr);
+    inet_aton(RT_LWIP_MSKADDR, &addr);
+    netdev_set_netmask(netdev, &addr);
+    LOG_I("ethernet static address %s.", RT_LWIP_IPADDR);
+#else
+    LOG_I("ethernet address from dhcp.");
+#endif
+}
+#endif
+
+#ifdef RT_USING_WIFI
+/* the soft-AP takes seconds, the other transports do not wait for it */
+static void wifi_bringup_entry(void *parameter) {
+    rt_tick_t tick = rt_tick_get();
+
+    wifi_spi_device_init();
+    if (rt_wlan_start_ap("HPM", RT_NULL) != RT_EOK) {
+        LOG_E("wifi ap start failed.");
+        return;
+    }
+
+    LOG_I("wifi ap ready:%u tick", rt_tick_get() - tick);
+    rt_event_send(&g_system.event, SYSTEM_EVENT_WIFI_READY);
+}
+#endif
+
+/* the servers bind INADDR_ANY, they serve each interface once it comes up */
+static void service_bringup_entry(void *parameter) {
+#ifdef BSP_USING_ETH
+    eth_network_init();
+    rt_event_send(&g_system.event, SYSTEM_EVENT_ETH_READY);
+#endif
+    internal_web_init();
+    tftp_server_init();
+    rt_event_send(&g_system.event, SYSTEM_EVENT_SERVICE_READY);
+}
+
+static void bringup_start(const char *name, void (*entry)(void *parameter)) {
+    rt_thread_t tid = rt_thread_create(name, entry, RT_NULL, BRINGUP_THREAD_STACK_SIZE,
+                                       BRINGUP_THREAD_PRIORITY, 10);
+    if (tid == RT_NULL) {
+        LOG_W("create %s thread failed, bring up in place.", name);
+        entry(RT_NULL);
+        return;
+    }
+
+    rt_thread_startup(tid);
+}
+
+static void network_init(void) {
+#ifdef RT_USING_WIFI
+    bringup_start("wifi_up", wifi_bringup_entry);
+#endif
+    bringup_start("svc_up", service_bringup_entry);
+}
+
 static int system_init(void) {
+    rt_event_init(&g_system.event, "system", RT_IPC_FLAG_FIFO);
+    boot_handoff_report();
+
     int rc = fal_init();
     if (rc <= 0) return -RT_ERROR;
 
@@ -43,23 +151,88 @@ static int system_init(void) {
     return RT_EOK;
 }
 
+void system_quit(void) {
+    g_system.is_quit = 1;
+    rt_event_send(&g_system.event, SYSTEM_EVENT_QUIT);
+}
+
+/* web, tftp and http pull run in their own threads, each one takes the partitions before the
+ * first erase and releases them when it is done, so does the sd card step of the main loop. Nothing is taken after a firmware is received. */
+int system_update_take(const char *owner) {
+    const char *busy = RT_NULL;
+
+    rt_base_t level = rt_hw_interrupt_disable();
+    if (g_system.is_quit)
+        busy = "quit";
+    else if (_update_owner != RT_NULL)
+        busy = _update_owner;
+    else
+        _update_owner = owner;
+    rt_hw_interrupt_enable(level);
+
+    if (busy != RT_NULL) {
+        LOG_W("%s update rejected, busy with %s.", owner, busy);
+        return -RT_EBUSY;
+    }
+
+    return RT_EOK;
+}
+
+void system_update_release(void) { _update_owner = RT_NULL; }
+
+static rt_int32_t timeout_min(rt_int32_t a, rt_int32_t b) {
+    if (a == RT_WAITING_FOREVER) return b;
+    if (b == RT_WAITING_FOREVER) return a;
+
+    return (a < b) ? a : b;
+}
+
+/* sleep until an event comes or the nearest deadline: rs485 frame gap, key hold, jump timeout */
+static void system_wait(rt_tick_t start_tick) {
+    rt_int32_t timeout = timeout_min(iap_timeout(), key_timeout());
+
+    if ((g_system.step == SYSTEM_STEP_WAIT_SYNC) && !sdcard_checking()) {
+        rt_tick_t passed = rt_tick_get() - start_tick;
+        rt_tick_t boot_timeout = rt_tick_from_millisecond(ENTER_BOOT_TIMEOUT);
+        timeout = timeout_min(timeout, (passed >= boot_timeout) ? 0 : (boot_timeout - passed));
+    }
+
+    if (timeout == 0) return;
+
+    rt_event_recv(&g_system.event, SYSTEM_EVENT_ALL, RT_EVENT_FLAG_OR | RT_EVENT_FLAG_CLEAR, timeout,
+                  RT_NULL);
+}
+
 void system_process(void) {
     static rt_tick_t _pre_tick = 0;
+    /* a card found while another transport holds the partitions is skipped, the loop goes on */
+    static int _sdcard_back_step = SYSTEM_STEP_WAIT_SYNC;
+    static rt_bool_t _sdcard_skip = RT_FALSE;
 
     if ((g_system.step == SYSTEM_STEP_WAIT_SYNC) || (g_system.step == SYSTEM_STEP_BOOT_PROCESS)) {
+        system_wait(_pre_tick);
+
         if (iap_process() != RT_EOK) g_system.step = SYSTEM_STEP_ERROR;
         if (key_process() != RT_EOK) g_system.step = SYSTEM_STEP_ERROR;
-        if (sdcard_check() == RT_EOK) g_system.step = SYSTEM_STEP_SDCARD;
+        if (!_sdcard_skip && (sdcard_check() == RT_EOK)) {
+            _sdcard_back_step = g_system.step;
+            g_system.step = SYSTEM_STEP_SDCARD;
+        }
     }
 
     switch (g_system.step) {
         case SYSTEM_STEP_INIT: {
             int rc = system_init();
+            if (rc == RT_EOK) rc = iap_init();
+            if (rc == RT_EOK) rc = key_init();
             if (rc != RT_EOK) {
                 g_system.step = SYSTEM_STEP_ERROR;
                 break;
             }
 
+            /* starts the card check thread */
+            sdcard_check();
+
             _pre_tick = rt_tick_get();
             g_system.step = SYSTEM_STEP_WAIT_SYNC;
         } break;
@@ -67,14 +240,14 @@ void system_process(void) {
         case SYSTEM_STEP_WAIT_SYNC: {
             if (g_system.is_remain) {
                 LOG_I("sync:%u tick, enter boot", rt_tick_get() - _pre_tick);
-                wifi_spi_device_init();
-                rt_wlan_start_ap("HPM", RT_NULL);
-                internal_web_init();
+                network_init();
                 g_system.step = SYSTEM_STEP_BOOT_PROCESS;
                 break;
             }
 
-            if ((rt_tick_get() - _pre_tick) >= rt_tick_from_millisecond(ENTER_BOOT_TIMEOUT)) {
+            /* a card being mounted gets to finish before the jump */
+            if (((rt_tick_get() - _pre_tick) >= rt_tick_from_millisecond(ENTER_BOOT_TIMEOUT)) &&
+                !sdcard_checking()) {
                 LOG_W("wait sync timeout:%u tick, will jump.", rt_tick_get() - _pre_tick);
                 g_system.step = SYSTEM_STEP_UPDATE;
                 break;
@@ -91,7 +264,26 @@ void system_process(void) {
         } break;
 
         case SYSTEM_STEP_SDCARD: {
+            if (system_update_take("sd") != RT_EOK) {
+                _sdcard_skip = RT_TRUE;
+                g_system.step = _sdcard_back_step;
+                break;
+            }
+#if SDCARD_DIRECT_INSTALL
+            int rc = sdcard_install();
+            /* the partitions stay taken until the jump */
+            if (rc == RT_EOK) boot_app_enable();
+            if (rc == -RT_EIO) {
+                /* the file is still on the card, the next boot installs it again */
+                LOG_E("firm install failed. now restart");
+                rt_hw_interrupt_disable();
+                ppor_sw_reset(HPM_PPOR, 10);
+            }
+#else
+            g_system.download_verified = 0;
             sdcard_update();
+#endif
+            system_update_release();
             g_system.step = SYSTEM_STEP_UPDATE;
         } break;
 
@@ -100,7 +292,13 @@ void system_process(void) {
             const struct fal_partition *download_part = g_system.download_part;
             firm_pkg_t download_header = {0};
 
-            int rc = check_part_firm(download_part, &download_header);
+            int rc = RT_EOK;
+            if (g_system.download_verified) {
+                LOG_I("The partition \'%s\' is verified on receiving.", download_part->name);
+                download_header = g_system.download_header;
+            } else {
+                rc = check_part_firm(download_part, &download_header);
+            }
             if (rc == RT_EOK) {
                 rc = firm_upgrade(download_part, &download_header, app_part);
                 if (rc == RT_EOK) {
@@ -0,0 +1,432 @@
+#include "tftp_server.h"
+#include "common.h"
+#include "boot.h"
+#include <rtthread.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <netdb.h>
+
+#define DBG_TAG "tftp"
+#define DBG_LVL DBG_LOG
+#include <rtdbg.h>
+
+#define TFTP_PORT            69
+#define TFTP_BLKSIZE_DEFAULT 512
+#define TFTP_BLKSIZE_MAX     1468 /* one block in one ethernet frame */
+#define TFTP_WINDOWSIZE_MAX  32
+#define TFTP_TIMEOUT         1
+#define TFTP_RETRY           5
+#define TFTP_STACK_SIZE      4096
+#define TFTP_PRIORITY        20
+
+enum {
+    TFTP_OP_RRQ = 1,
+    TFTP_OP_WRQ,
+    TFTP_OP_DATA,
+    TFTP_OP_ACK,
+    TFTP_OP_ERROR,
+    TFTP_OP_OACK,
+};
+
+enum {
+    TFTP_ERR_UNDEF = 0,
+    TFTP_ERR_NOT_FOUND,
+    TFTP_ERR_ACCESS,
+    TFTP_ERR_DISK_FULL,
+    TFTP_ERR_ILLEGAL_OP,
+    TFTP_ERR_UNKNOWN_TID,
+    TFTP_ERR_OPTION = 8,
+};
+
+typedef struct {
+    int sock;
+    struct sockaddr_in peer;
+    const struct fal_partition *part;
+    size_t erase_size;
+    uint32_t erased;
+    uint32_t offset;
+    uint32_t tsize;
+    uint16_t blksize;
+    uint16_t windowsize;
+    uint16_t block;
+    int need_verify;
+    firm_verify_t verify;
+} tftp_session_t;
+
+static uint8_t _tftp_buf[4 + TFTP_BLKSIZE_MAX];
+static uint8_t _oack_buf[64];
+
+static void tftp_send_ack(tftp_session_t *session, uint16_t block) {
+    uint8_t pkt[4] = {0, TFTP_OP_ACK, block >> 8, block & 0xFF};
+
+    sendto(session->sock, pkt, sizeof(pkt), 0, (struct sockaddr *)&session->peer,
+           sizeof(session->peer));
+}
+
+static void tftp_send_error(int sock, struct sockaddr_in *peer, uint16_t code, const char *msg) {
+    uint8_t pkt[64];
+    int len = strlen(msg);
+
+    if (len > sizeof(pkt) - 5) len = sizeof(pkt) - 5;
+    pkt[0] = 0;
+    pkt[1] = TFTP_OP_ERROR;
+    pkt[2] = code >> 8;
+    pkt[3] = code & 0xFF;
+    memcpy(pkt + 4, msg, len);
+    pkt[4 + len] = '\0';
+
+    sendto(sock, pkt, len + 5, 0, (struct sockaddr *)peer, sizeof(*peer));
+}
+
+static const struct fal_partition *tftp_find_part(const char *filename, int *need_verify) {
+    *need_verify = 0;
+
+    if ((strcmp(filename, APP_PART_NAME) == 0) || strstr(filename, ".bin")) {
+        return g_system.app_part;
+    }
+
+    if ((strcmp(filename, DOWNLOAD_PART_NAME) == 0) || strstr(filename, ".rbl")) {
+        *need_verify = 1;
+        return g_system.download_part;
+    }
+
+    return RT_NULL;
+}
+
+/**
+ * Parse the write request and its options (RFC 2347).
+ *
+ * @return the length of the OACK packet, 0 when there is no accepted option, < 0 on error
+ */
+static int tftp_parse_request(tftp_session_t *session, uint8_t *pkt, int len) {
+    char *ptr = (char *)pkt + 2, *end = (char *)pkt + len;
+    char *filename, *mode;
+    int oack_len = 2, seen = 0;
+
+    if (pkt[len - 1] != '\0') {
+        tftp_send_error(session->sock, &session->peer, TFTP_ERR_ILLEGAL_OP, "bad request");
+        return -RT_ERROR;
+    }
+
+    filename = ptr;
+    ptr += strlen(ptr) + 1;
+    if (ptr >= end) {
+        tftp_send_error(session->sock, &session->peer, TFTP_ERR_ILLEGAL_OP, "bad request");
+        return -RT_ERROR;
+    }
+    mode = ptr;
+    ptr += strlen(ptr) + 1;
+
+    if (strcasecmp(mode, "octet") != 0) {
+        tftp_send_error(session->sock, &session->peer, TFTP_ERR_ILLEGAL_OP, "only octet mode");
+        return -RT_ERROR;
+    }
+
+    session->part = tftp_find_part(filename, &session->need_verify);
+    if (session->part == RT_NULL) {
+        LOG_W("file %s has no partition.", filename);
+        tftp_send_error(session->sock, &session->peer, TFTP_ERR_NOT_FOUND, "unknown file");
+        return -RT_ERROR;
+    }
+    LOG_I("write %s to partition \'%s\'.", filename, session->part->name);
+
+    _oack_buf[0] = 0;
+    _oack_buf[1] = TFTP_OP_OACK;
+    while (ptr < end) {
+        char *name = ptr;
+        ptr += strlen(ptr) + 1;
+        if (ptr >= end) break;
+        char *value = ptr;
+        ptr += strlen(ptr) + 1;
+
+        long val = strtol(value, RT_NULL, 10);
+        int opt;
+        if (strcasecmp(name, "blksize") == 0) {
+            /* RFC 2348 */
+            if (val < 8) continue;
+            if (val > TFTP_BLKSIZE_MAX) val = TFTP_BLKSIZE_MAX;
+            opt = 0;
+        } else if (strcasecmp(name, "windowsize") == 0) {
+            /* RFC 7440 */
+            if (val < 1) continue;
+            if (val > TFTP_WINDOWSIZE_MAX) val = TFTP_WINDOWSIZE_MAX;
+            opt = 1;
+        } else if (strcasecmp(name, "tsize") == 0) {
+            /* RFC 2349 */
+            if (val < 0) {
+                tftp_send_error(session->sock, &session->peer, TFTP_ERR_OPTION, "bad tsize");
+                return -RT_ERROR;
+            }
+            if (val > session->part->len) {
+                tftp_send_error(session->sock, &session->peer, TFTP_ERR_DISK_FULL, "file too large");
+                return -RT_ERROR;
+            }
+            opt = 2;
+        } else {
+            continue;
+        }
+
+        /* each option is answered once, and one that does not fit in the OACK is not taken */
+        if (seen & (1 << opt)) continue;
+        char num[12];
+        int name_len = strlen(name), num_len = snprintf(num, sizeof(num), "%ld", val);
+        if (name_len + 1 + num_len + 1 > (int)sizeof(_oack_buf) - oack_len) continue;
+        seen |= 1 << opt;
+
+        if (opt == 0)
+            session->blksize = val;
+        else if (opt == 1)
+            session->windowsize = val;
+        else
+            session->tsize = val;
+
+        memcpy(_oack_buf + oack_len, name, name_len + 1);
+        oack_len += name_len + 1;
+        memcpy(_oack_buf + oack_len, num, num_len + 1);
+        oack_len += num_len + 1;
+    }
+
+    return (oack_len > 2) ? oack_len : 0;
+}
+
+static int tftp_write(tftp_session_t *session, const uint8_t *data, int len) {
+    const struct fal_partition *part = session->part;
+
+    if (session->offset + len > part->len) {
+        tftp_send_error(session->sock, &session->peer, TFTP_ERR_DISK_FULL, "file too large");
+        return -RT_ERROR;
+    }
+
+    /* like the web upload, a block reaches the flash only after the header has accepted it */
+    if (session->need_verify && firm_verify_update(&session->verify, data, len) != RT_EOK) {
+        tftp_send_error(session->sock, &session->peer, TFTP_ERR_UNDEF, "firmware header error");
+        return -RT_ERROR;
+    }
+
+    /* erase just ahead of the data, the first ack is not delayed by a whole partition erase */
+    if (session->offset + len > session->erased) {
+        uint32_t size = RT_ALIGN(session->offset + len - session->erased, session->erase_size);
+        if (session->erased + size > part->len) size = part->len - session->erased;
+
+        if (fal_partition_erase(part, session->erased, size) < 0) {
+            tftp_send_error(session->sock, &session->peer, TFTP_ERR_ACCESS, "erase failed");
+            return -RT_ERROR;
+        }
+        session->erased += size;
+    }
+
+    if (fal_partition_write(part, session->offset, data, len) < 0) {
+        tftp_send_error(session->sock, &session->peer, TFTP_ERR_ACCESS, "write failed");
+        return -RT_ERROR;
+    }
+
+    session->offset += len;
+
+    return RT_EOK;
+}
+
+static int tftp_receive(tftp_session_t *session, int oack_len) {
+    struct sockaddr_in from;
+    socklen_t fromlen;
+    uint16_t block = 0;
+    int count = 0, retry = 0, nak_sent = 0;
+
+    if (oack_len > 0)
+        sendto(session->sock, _oack_buf, oack_len, 0, (struct sockaddr *)&session->peer,
+               sizeof(session->peer));
+    else
+        tftp_send_ack(session, 0);
+
+    while (1) {
+        fromlen = sizeof(from);
+        int len = recvfrom(session->sock, _tftp_buf, sizeof(_tftp_buf), 0, (struct sockaddr *)&from,
+                           &fromlen);
+        if (len < 0) {
+            if (++retry > TFTP_RETRY) {
+                LOG_W("receive block %d timeout.", (uint16_t)(block + 1));
+                return -RT_ERROR;
+            }
+
+            /* timeout, the window restarts after the last good block */
+            if ((session->offset == 0) && (oack_len > 0))
+                sendto(session->sock, _oack_buf, oack_len, 0, (struct sockaddr *)&session->peer,
+                       sizeof(session->peer));
+            else
+                tftp_send_ack(session, block);
+            count = 0;
+            continue;
+        }
+
+        if ((from.sin_addr.s_addr != session->peer.sin_addr.s_addr) ||
+            (from.sin_port != session->peer.sin_port)) {
+            tftp_send_error(session->sock, &from, TFTP_ERR_UNKNOWN_TID, "unknown transfer id");
+            continue;
+        }
+
+        uint16_t opcode = (_tftp_buf[0] << 8) | _tftp_buf[1];
+        if (opcode == TFTP_OP_ERROR) {
+            LOG_W("transfer aborted by peer.");
+            return -RT_ERROR;
+        }
+        if ((opcode != TFTP_OP_DATA) || (len < 4) || (len - 4 > session->blksize)) {
+            tftp_send_error(session->sock, &session->peer, TFTP_ERR_ILLEGAL_OP, "bad data");
+            return -RT_ERROR;
+        }
+
+        uint16_t num = (_tftp_buf[2] << 8) | _tftp_buf[3];
+        if (num != (uint16_t)(block + 1)) {
+            /* lost or reordered block, ack the last good one once so the window restarts there */
+            if (!nak_sent) {
+                tftp_send_ack(session, block);
+                nak_sent = 1;
+                count = 0;
+            }
+            continue;
+        }
+        nak_sent = 0;
+        retry = 0;
+
+        if (tftp_write(session, _tftp_buf + 4, len - 4) != RT_EOK) return -RT_ERROR;
+        block = num;
+        count++;
+
+        if (len - 4 < session->blksize) break;
+
+        if (count >= session->windowsize) {
+            tftp_send_ack(session, block);
+            count = 0;
+        }
+    }
+
+    /* the last block, verify before the final ack so the client sees the result */
+    if (session->need_verify && firm_verify_final(&session->verify) != RT_EOK) {
+        tftp_send_error(session->sock, &session->peer, TFTP_ERR_UNDEF, "firmware verify failed");
+        return -RT_ERROR;
+    }
+    tftp_send_ack(session, block);
+    session->block = block;
+
+    return RT_EOK;
+}
+
+/* the final ack may get lost, answer a retransmitted last block once */
+static void tftp_dally(tftp_session_t *session) {
+    struct sockaddr_in from;
+    socklen_t fromlen = sizeof(from);
+
+    if (recvfrom(session->sock, _tftp_buf, sizeof(_tftp_buf), 0, (struct sockaddr *)&from,
+                 &fromlen) >= 4) {
+        if (((_tftp_buf[0] << 8) | _tftp_buf[1]) == TFTP_OP_DATA) tftp_send_ack(session, session->block);
+    }
+}
+
+static void tftp_handle_request(struct sockaddr_in *peer, int len) {
+    tftp_session_t session = {0};
+    struct sockaddr_in local = {0};
+    struct timeval timeout = {TFTP_TIMEOUT, 0};
+    int taken = 0;
+
+    session.peer = *peer;
+    session.blksize = TFTP_BLKSIZE_DEFAULT;
+    session.windowsize = 1;
+
+    /* every transfer uses a new port as its transfer id */
+    session.sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (session.sock < 0) return;
+    local.sin_family = AF_INET;
+    local.sin_port = 0;
+    local.sin_addr.s_addr = INADDR_ANY;
+    if (bind(session.sock, (struct sockaddr *)&local, sizeof(local)) < 0) {
+        closesocket(session.sock);
+        return;
+    }
+    setsockopt(session.sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    do {
+        uint16_t opcode = (_tftp_buf[0] << 8) | _tftp_buf[1];
+        if (opcode != TFTP_OP_WRQ) {
+            tftp_send_error(session.sock, peer, TFTP_ERR_ILLEGAL_OP, "only write is supported");
+            break;
+        }
+
+        int oack_len = tftp_parse_request(&session, _tftp_buf, len);
+        if (oack_len < 0) break;
+
+        if (system_update_take("tftp") != RT_EOK) {
+            tftp_send_error(session.sock, peer, TFTP_ERR_ACCESS, "update in progress");
+            break;
+        }
+        taken = 1;
+
+        const struct fal_flash_dev *flash = fal_flash_device_find(session.part->flash_name);
+        session.erase_size = (flash != RT_NULL) ? flash->blk_size : 4096;
+
+        /* a flag left by an earlier .rbl must not outlive this transfer, a .bin included */
+        g_system.download_verified = 0;
+        if (session.need_verify) firm_verify_init(&session.verify, session.part->name);
+
+        LOG_I("blksize %d, windowsize %d, tsize %u.", session.blksize, session.windowsize,
+              session.tsize);
+
+        rt_tick_t tick = rt_tick_get();
+        if (tftp_receive(&session, oack_len) != RT_EOK) {
+            LOG_E("write partition \'%s\' failed at %u.", session.part->name, session.offset);
+            break;
+        }
+
+        tick = (rt_tick_get() - tick) * 1000 / RT_TICK_PER_SECOND;
+        LOG_I("received %u bytes in %u ms.", session.offset, tick);
+        tftp_dally(&session);
+
+        if (session.need_verify) {
+            g_system.download_header = session.verify.header;
+            g_system.download_verified = 1;
+        }
+        system_quit();
+    } while (0);
+
+    if (taken) system_update_release();
+    closesocket(session.sock);
+}
+
+static void tftp_server_entry(void *parameter) {
+    struct sockaddr_in local = {0}, peer;
+    socklen_t peerlen;
+
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        LOG_E("create socket failed.");
+        return;
+    }
+
+    local.sin_family = AF_INET;
+    local.sin_port = htons(TFTP_PORT);
+    local.sin_addr.s_addr = INADDR_ANY;
+    if (bind(sock, (struct sockaddr *)&local, sizeof(local)) < 0) {
+        LOG_E("bind port %d failed.", TFTP_PORT);
+        closesocket(sock);
+        return;
+    }
+
+    LOG_I("tftp server listen on port %d.", TFTP_PORT);
+
+    while (1) {
+        peerlen = sizeof(peer);
+        int len = recvfrom(sock, _tftp_buf, sizeof(_tftp_buf), 0, (struct sockaddr *)&peer, &peerlen);
+        if (len < 4) continue;
+
+        tftp_handle_request(&peer, len);
+    }
+}
+
+int tftp_server_init(void) {
+    rt_thread_t tid = rt_thread_create("tftpd", tftp_server_entry, RT_NULL, TFTP_STACK_SIZE,
+                                       TFTP_PRIORITY, 10);
+    if (tid == RT_NULL) return -RT_ERROR;
+
+    rt_thread_startup(tid);
+
+    return RT_EOK;
+}
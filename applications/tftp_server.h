@@ -0,0 +1,6 @@
+#ifndef __TFTP_SERVER_H
+#define __TFTP_SERVER_H
+
+int tftp_server_init(void);
+
+#endif
@@ -4,6 +4,8 @@
 #include <stdio.h>
 #include <fal.h>
 #include "common.h"
+#include "boot.h"
+#include "http_ota.h"
 
 #define DBG_TAG "web.firm"
 #define DBG_LVL DBG_LOG
@@ -11,6 +13,11 @@
 
 static int file_size = 0;
 static uint8_t update_ok = 0;
+static uint8_t need_verify = 0;
+static uint8_t verify_failed = 0;
+static firm_verify_t firm_verify;
+/* the session owning the partitions and the state above, the others are rejected */
+static struct webnet_session *upload_owner = RT_NULL;
 
 static const char *get_file_name(struct webnet_session *session) {
     const char *path = RT_NULL, *path_last = RT_NULL;
@@ -39,9 +46,7 @@ static const char *get_file_name(struct webnet_session *session) {
 static int upload_open(struct webnet_session *session) {
     const char *file_name = RT_NULL;
     const struct fal_partition *using_part = RT_NULL;
-
-    file_size = 0;
-    update_ok = 0;
+    int verify = 0;
 
     file_name = get_file_name(session);
     if (file_name == RT_NULL) return RT_NULL;
@@ -55,11 +60,22 @@ static int upload_open(struct webnet_session *session) {
     } else if (strstr(file_name, ".rbl")) {
         LOG_I("using download part");
         using_part = g_system.download_part;
+        verify = 1;
     } else {
         LOG_W("Unsupported file type.");
         return RT_NULL;
     }
 
+    if (system_update_take("web") != RT_EOK) return RT_NULL;
+    upload_owner = session;
+
+    file_size = 0;
+    update_ok = 0;
+    need_verify = verify;
+    verify_failed = 0;
+    g_system.download_verified = 0;
+    if (need_verify) firm_verify_init(&firm_verify, using_part->name);
+
     LOG_I("The partition \'%s\' is erasing.", using_part->name);
     int len = fal_partition_erase_all(using_part);
     if (len <= 0) {
@@ -73,10 +89,17 @@ static int upload_open(struct webnet_session *session) {
     return (int)using_part;
 }
 
-static int upload_close(struct webnet_session *session) { return 0; }
+static int upload_close(struct webnet_session *session) {
+    if (session == upload_owner) {
+        upload_owner = RT_NULL;
+        system_update_release();
+    }
+
+    return 0;
+}
 
 static int upload_write(struct webnet_session *session, const void *data, rt_size_t length) {
-    if (update_ok == 0) return 0;
+    if ((session != upload_owner) || (update_ok == 0)) return 0;
 
     const struct fal_partition *using_part =
         (const struct fal_partition *)webnet_upload_get_userdata(session);
@@ -93,6 +116,13 @@ static int upload_write(struct webnet_session *session, const void *data, rt_siz
         return 0;
     }
 
+    if (need_verify && firm_verify_update(&firm_verify, data, length) != RT_EOK) {
+        LOG_W("firm header error, upload rejected");
+        verify_failed = 1;
+        update_ok = 0;
+        return 0;
+    }
+
     int len = fal_partition_write(using_part, file_size, data, length);
     if (len <= 0) {
         LOG_W("write error");
@@ -108,10 +138,26 @@ static int upload_write(struct webnet_session *session, const void *data, rt_siz
 static int upload_done(struct webnet_session *session) {
     const char *mimetype;
 
+    const char *verify = "none";
+    int owner = (session == upload_owner);
+
     LOG_I("Upload done.");
 
+    if (owner && update_ok && need_verify) {
+        if (firm_verify_final(&firm_verify) == RT_EOK) {
+            verify = "ok";
+            g_system.download_header = firm_verify.header;
+            g_system.download_verified = 1;
+        } else {
+            verify_failed = 1;
+            update_ok = 0;
+        }
+    }
+    if (owner && verify_failed) verify = "fail";
+
     char tmp[100] = "";
-    snprintf(tmp, sizeof(tmp), "{\"code\":%d,\"filesize\":%d}", update_ok ? 0 : -1, file_size);
+    snprintf(tmp, sizeof(tmp), "{\"code\":%d,\"filesize\":%d,\"verify\":\"%s\"}",
+             (owner && update_ok) ? 0 : -1, owner ? file_size : 0, verify);
 
     /* get mimetype */
     mimetype = mime_get_type(".html");
@@ -121,10 +167,29 @@ static int upload_done(struct webnet_session *session) {
     webnet_session_set_header(session, mimetype, 200, "Ok", rt_strlen(tmp));
     webnet_session_printf(session, tmp);
 
-    g_system.is_quit = 1;
+    /* a rejected image keeps the boot web alive for another try */
+    if (owner && update_ok) system_quit();
 
     return 0;
 }
 
+/* /cgi-bin/ota?url=http://... starts a pull update, without url it reports the state */
+void cgi_http_ota(struct webnet_session *session) {
+    const char *url = webnet_request_get_query(session->request, "url");
+    uint32_t recv_size, total_size;
+    int rc = RT_EOK;
+
+    if (url != RT_NULL) rc = http_ota_start(url);
+    int state = http_ota_get_state(&recv_size, &total_size);
+
+    char tmp[100] = "";
+    snprintf(tmp, sizeof(tmp), "{\"code\":%d,\"state\":%d,\"recv\":%u,\"total\":%u}", rc, state,
+             recv_size, total_size);
+
+    session->request->result_code = 200;
+    webnet_session_set_header(session, mime_get_type(".html"), 200, "Ok", rt_strlen(tmp));
+    webnet_session_printf(session, tmp);
+}
+
 const struct webnet_module_upload_entry upload_entry_firm = {"/firm", upload_open, upload_close,
                                                              upload_write, upload_done};
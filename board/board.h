@@ -167,6 +167,8 @@
 #define BOARD_ENET1_INT_REF_CLK     (0U)
 #define BOARD_ENET1_PHY_RST_TIME    (30)
 #define BOARD_ENET1_PTP_CLOCK       (clock_ptp1)
+/* the LAN8720A nINT pin doubles as REFCLKO, which clocks RMII on this board: no PHY interrupt,
+ * boards that wire nINT to a GPIO define BOARD_ENET1_PHY_INT_PIN (rt_pin number) */
 /* adc section */
 #define BOARD_APP_ADC12_BASE HPM_ADC0
 #define BOARD_APP_ADC16_BASE HPM_ADC3
@@ -197,6 +199,7 @@
 
 /* SDXC section */
 #define BOARD_APP_SDCARD_SDXC_BASE            (HPM_SDXC1)
+#define BOARD_APP_SDCARD_SDXC_IRQ             IRQn_SDXC1
 #define BOARD_APP_SDCARD_SUPPORT_1V8          (0)
 
 /* USB section */
@@ -26,6 +26,7 @@ typedef struct
     struct eth_device *eth_dev;
     phy_device_t *phy_dev;
     struct rt_mdio_bus *mdio_bus;
+    rt_base_t int_pin;                   /* PHY nINT, -1 when the board does not wire it */
 } eth_phy_handle_t;
 
 typedef struct
@@ -47,6 +48,11 @@ static eth_phy_handle_t eth0_phy_handle =
     .phy_dev   = &phy0_dev,
     .mdio_name = "MDIO0",
     .mdio_bus  = &mdio0_bus,
+#ifdef BOARD_ENET0_PHY_INT_PIN
+    .int_pin   = BOARD_ENET0_PHY_INT_PIN,
+#else
+    .int_pin   = -1,
+#endif
 };
 #endif
 
@@ -63,6 +69,11 @@ static eth_phy_handle_t eth1_phy_handle =
     .phy_dev      = &phy1_dev,
     .mdio_name    = "MDIO1",
     .mdio_bus     = &mdio1_bus,
+#ifdef BOARD_ENET1_PHY_INT_PIN
+    .int_pin      = BOARD_ENET1_PHY_INT_PIN,
+#else
+    .int_pin      = -1,
+#endif
 };
 #endif
 
@@ -96,6 +107,9 @@ eth_phy_monitor_handle_t phy_monitor_handle =
 
 static struct rt_phy_ops phy_ops;
 
+/* released by the PHY interrupt, the monitor thread reads the link right away */
+static struct rt_semaphore phy_link_sem;
+
 static rt_phy_status phy_init(void *object, rt_uint32_t phy_addr, rt_uint32_t src_clock_hz)
 {
     return PHY_STATUS_OK;
@@ -163,6 +177,12 @@ static void phy_poll_status(void *parameter)
         eth_dev = phy_monitor_handle->phy_handle[i]->eth_dev;
         phy_dev = phy_monitor_handle->phy_handle[i]->phy_dev;
 
+        if (phy_monitor_handle->phy_handle[i]->int_pin >= 0)
+        {
+            /* reading the source register releases nINT */
+            enet_read_phy(phy_dev->phy.bus->hw_obj, phy_dev->phy.addr, PHY_INTERRUPT_FLAG_REG);
+        }
+
         phy_dev->phy.ops->get_link_status(&phy_dev->phy, &status);
 
         if (status)
@@ -228,9 +248,34 @@ static void phy_detection(void *parameter)
     LOG_D("Found a PHY, address:0x%02x\n", phy_dev->phy.addr);
 }
 
+static void phy_link_isr(void *args)
+{
+    rt_sem_release(&phy_link_sem);
+}
+
+/* Let the PHY raise nINT on link down and auto-negotiation complete */
+static rt_bool_t phy_link_irq_init(eth_phy_handle_t *handle)
+{
+    phy_device_t *phy_dev = handle->phy_dev;
+
+    if (handle->int_pin < 0)
+    {
+        return RT_FALSE;
+    }
+
+    enet_write_phy(handle->instance, phy_dev->phy.addr, PHY_INTERRUPT_MASK_REG, PHY_LINK_DOWN_MASK | PHY_AUTO_NEGO_COMPLETE_MASK);
+    enet_read_phy(handle->instance, phy_dev->phy.addr, PHY_INTERRUPT_FLAG_REG);
+
+    rt_pin_mode(handle->int_pin, PIN_MODE_INPUT_PULLUP);
+    rt_pin_attach_irq(handle->int_pin, PIN_IRQ_MODE_FALLING, phy_link_isr, RT_NULL);
+    rt_pin_irq_enable(handle->int_pin, PIN_IRQ_ENABLE);
+
+    return RT_TRUE;
+}
+
 static void phy_monitor_thread_entry(void *args)
 {
-    rt_timer_t phy_status_timer;
+    rt_int32_t poll_interval = PHY_LINK_IRQ_POLL_INTERVAL;
 
     eth_phy_monitor_handle_t *phy_monitor_handle = (eth_phy_monitor_handle_t *)args;
 
@@ -238,13 +283,18 @@ static void phy_monitor_thread_entry(void *args)
     {
         LOG_D("Detect a PHY%d\n", i);
         phy_detection(phy_monitor_handle->phy_handle[i]->phy_dev);
-    }
 
-    phy_status_timer = rt_timer_create("PHY_Monitor", phy_poll_status, phy_monitor_handle, RT_TICK_PER_SECOND, RT_TIMER_FLAG_PERIODIC);
+        if (!phy_link_irq_init(phy_monitor_handle->phy_handle[i]))
+        {
+            /* no interrupt line on this PHY: poll it fast enough */
+            poll_interval = PHY_LINK_POLL_INTERVAL;
+        }
+    }
 
-    if (!phy_status_timer || rt_timer_start(phy_status_timer) != RT_EOK)
+    while (1)
     {
-        LOG_E("Failed to start link change detection timer\n");
+        phy_poll_status(phy_monitor_handle);
+        rt_sem_take(&phy_link_sem, rt_tick_from_millisecond(poll_interval));
     }
 }
 
@@ -277,6 +327,8 @@ int phy_device_register(void)
         rt_hw_phy_register(&s_gphys[i]->phy_dev->phy, PHY_NAME);
     }
 
+    rt_sem_init(&phy_link_sem, "phy_link", 0, RT_IPC_FLAG_FIFO);
+
     /* Start PHY monitor */
     thread_phy_monitor = rt_thread_create("PHY Monitor", phy_monitor_thread_entry, &phy_monitor_handle, 1024, RT_THREAD_PRIORITY_MAX - 2, 2);
 
@@ -291,6 +343,5 @@ int phy_device_register(void)
 
     return err;
 }
-INIT_PREV_EXPORT(phy_device_register);
 #endif /* RT_USING_PHY */
 
@@ -19,6 +19,16 @@
 #define PHY_MDIO_CSR_CLK_FREQ (200000000U)
 #endif
 
+/* link status poll interval in ms when a PHY has no interrupt line */
+#ifndef PHY_LINK_POLL_INTERVAL
+#define PHY_LINK_POLL_INTERVAL (50U)
+#endif
+
+/* safety poll in ms when every PHY reports link changes on nINT */
+#ifndef PHY_LINK_IRQ_POLL_INTERVAL
+#define PHY_LINK_IRQ_POLL_INTERVAL (1000U)
+#endif
+
 enum phy_link_status
 {
    PHY_LINK_DOWN = 0U,
@@ -110,4 +120,7 @@ typedef struct {
 #define PHY_ID1_REG_IDX          (2U)
 #define PHY_STATUS_REG_IDX       (7U)
 
+/* not an init export, started together with the ENET device */
+int phy_device_register(void);
+
 #endif
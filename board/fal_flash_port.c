@@ -55,6 +55,14 @@ static int erase(long offset, size_t size);
 
 static xpi_nor_config_t s_flashcfg;
 
+/*
+ * Erase sectors written or erased since their cache lines were last invalidated. Program and
+ * erase go around the D-cache, so read() invalidates a sector once after it changed and reads
+ * through the cache otherwise. Sectors past the bitmap are invalidated on every read.
+ */
+#define FLASH_TRACK_SECTOR_NUM  (2048U)
+static uint8_t s_sector_modified[FLASH_TRACK_SECTOR_NUM / 8];
+
 /**
  * @brief FAL Flash device context
  */
@@ -99,9 +107,64 @@ FAL_RAMFUNC static int init(void)
         nor_flash0.len = flash_size;
     }
 
+    /* nothing is known about what the cache holds yet */
+    memset(s_sector_modified, 0xFF, sizeof(s_sector_modified));
+
     return ret;
 }
 
+/**
+ * @brief Note that a range was programmed or erased
+ * @param offset FLASH offset
+ * @param size Size of the range
+ */
+static void flash_mark_modified(long offset, size_t size)
+{
+    uint32_t sector = offset / nor_flash0.blk_size;
+    uint32_t end = (offset + size + nor_flash0.blk_size - 1U) / nor_flash0.blk_size;
+    rt_base_t level = rt_hw_interrupt_disable();
+
+    for (; (sector < end) && (sector < FLASH_TRACK_SECTOR_NUM); sector++)
+    {
+        s_sector_modified[sector / 8] |= (uint8_t) (1U << (sector % 8));
+    }
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * @brief Invalidate the cache lines of the modified sectors in a range
+ * @param offset FLASH offset
+ * @param size Size of the range
+ */
+static void flash_invalidate_modified(long offset, size_t size)
+{
+    uint32_t sector = offset / nor_flash0.blk_size;
+    uint32_t end = (offset + size + nor_flash0.blk_size - 1U) / nor_flash0.blk_size;
+    uint32_t flash_addr, aligned_start, aligned_end;
+    rt_base_t level;
+
+    for (; sector < end; sector++)
+    {
+        if (sector >= FLASH_TRACK_SECTOR_NUM)
+        {
+            flash_addr = nor_flash0.addr + offset;
+            aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(MAX(flash_addr, nor_flash0.addr + sector * nor_flash0.blk_size));
+            aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(flash_addr + size);
+            l1c_dc_invalidate(aligned_start, aligned_end - aligned_start);
+            break;
+        }
+
+        /* cleared before the invalidate, a write in between marks the sector again */
+        level = rt_hw_interrupt_disable();
+        if (s_sector_modified[sector / 8] & (1U << (sector % 8)))
+        {
+            s_sector_modified[sector / 8] &= (uint8_t) ~(1U << (sector % 8));
+            l1c_dc_invalidate(nor_flash0.addr + sector * nor_flash0.blk_size, nor_flash0.blk_size);
+        }
+        rt_hw_interrupt_enable(level);
+    }
+}
+
 /**
  * @brief FAL read function
  *        Read data from FLASH
@@ -113,10 +176,8 @@ FAL_RAMFUNC static int init(void)
 FAL_RAMFUNC static int read(long offset, uint8_t *buf, size_t size)
 {
     uint32_t flash_addr = nor_flash0.addr + offset;
-    uint32_t aligned_start = HPM_L1C_CACHELINE_ALIGN_DOWN(flash_addr);
-    uint32_t aligned_end = HPM_L1C_CACHELINE_ALIGN_UP(flash_addr + size);
-    uint32_t aligned_size = aligned_end - aligned_start;
-    l1c_dc_invalidate(aligned_start, aligned_size);
+
+    flash_invalidate_modified(offset, size);
 
     (void) memcpy(buf, (void*) flash_addr, size);
 
@@ -157,6 +218,7 @@ FAL_RAMFUNC static int write_unaligned_page_data(long offset, const uint32_t *bu
  */
 FAL_RAMFUNC static int write(long offset, const uint8_t *buf, size_t size)
 {
+    long start = offset;
     uint32_t *src = NULL;
     uint32_t buf_32[64];
     uint32_t write_size;
@@ -207,6 +269,7 @@ FAL_RAMFUNC static int write(long offset, const uint8_t *buf, size_t size)
     }
 
 write_quit:
+    flash_mark_modified(start, size);
     return ret;
 }
 
@@ -221,6 +284,7 @@ write_quit:
 FAL_RAMFUNC static int erase(long offset, size_t size)
 {
     uint32_t aligned_size = (size + nor_flash0.blk_size - 1U) & ~(nor_flash0.blk_size - 1U);
+    long start = offset;
     hpm_stat_t status;
     int ret = (int)size;
 
@@ -239,6 +303,58 @@ FAL_RAMFUNC static int erase(long offset, size_t size)
         aligned_size -= nor_flash0.blk_size;
     }
 
+    /* marked once done, a read in between must not clear the mark early */
+    flash_mark_modified(start, size);
     return ret;
 }
+
+/* repeated 4 KB partition reads, with the cache kept and with an invalidate before each read */
+static void fal_read_bench(int argc, char **argv)
+{
+    const char *name = (argc > 1) ? argv[1] : "app";
+    uint32_t count = (argc > 2) ? atoi(argv[2]) : 10000;
+    const struct fal_partition *part = fal_partition_find(name);
+    const struct fal_flash_dev *flash;
+    uint8_t *buf;
+    rt_tick_t tick;
+    uint32_t i, ms[2];
+
+    if ((part == RT_NULL) || (count == 0) || (part->len < 4096))
+    {
+        rt_kprintf("usage: fal_read_bench [partition] [count]\n");
+        return;
+    }
+    flash = fal_flash_device_find(part->flash_name);
+    buf = rt_malloc(4096);
+    if ((flash == RT_NULL) || (buf == RT_NULL))
+    {
+        rt_free(buf);
+        return;
+    }
+
+    for (int pass = 0; pass < 2; pass++)
+    {
+        tick = rt_tick_get();
+        for (i = 0; i < count; i++)
+        {
+            if ((pass == 1) && (flash == &nor_flash0))
+            {
+                flash_mark_modified(part->offset, 4096);
+            }
+            if (fal_partition_read(part, 0, buf, 4096) != 4096)
+            {
+                rt_kprintf("read %s failed\n", name);
+                rt_free(buf);
+                return;
+            }
+        }
+        ms[pass] = (rt_tick_get() - tick) * 1000 / RT_TICK_PER_SECOND;
+    }
+    rt_free(buf);
+
+    rt_kprintf("%u x 4096 bytes from %s\n", count, name);
+    rt_kprintf("cached     : %u ms, %u ns per read\n", ms[0], (uint32_t) ((uint64_t) ms[0] * 1000000 / count));
+    rt_kprintf("invalidated: %u ms, %u ns per read\n", ms[1], (uint32_t) ((uint64_t) ms[1] * 1000000 / count));
+}
+MSH_CMD_EXPORT(fal_read_bench, time repeated 4 KB reads of a fal partition);
 #endif /* PKG_USING_FAL */
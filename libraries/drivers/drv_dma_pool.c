@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <rtthread.h>
+#include <rthw.h>
+#include "board.h"
+#include "hpm_l1c_drv.h"
+#include "drv_dma_pool.h"
+
+#define DBG_TAG "drv.dma_pool"
+#define DBG_LVL DBG_INFO
+#include <rtdbg.h>
+
+struct dma_pool_block
+{
+    struct dma_pool_block *next;
+};
+
+struct dma_pool
+{
+    rt_uint8_t *cur;                    /* blocks are carved from here when a free list is empty */
+    rt_uint8_t *end;
+    struct dma_pool_block *free_list[DMA_POOL_CLASS_NUM];
+    rt_uint32_t free_cnt[DMA_POOL_CLASS_NUM];
+    rt_uint32_t used_cnt[DMA_POOL_CLASS_NUM];
+    rt_uint32_t fail_cnt;
+};
+
+static struct dma_pool s_dma_pool;
+
+static int dma_pool_class(rt_size_t size)
+{
+    rt_uint32_t cls = 0;
+
+    while ((cls < DMA_POOL_CLASS_NUM) && ((1UL << (DMA_POOL_MIN_SHIFT + cls)) < size))
+    {
+        cls++;
+    }
+
+    return (cls < DMA_POOL_CLASS_NUM) ? (int) cls : -1;
+}
+
+/* called with the interrupt disabled */
+static void *dma_pool_carve(rt_uint32_t cls)
+{
+    rt_size_t block_size = 1UL << (DMA_POOL_MIN_SHIFT + cls);
+    void *block;
+
+    if ((rt_size_t) (s_dma_pool.end - s_dma_pool.cur) < block_size)
+    {
+        return RT_NULL;
+    }
+    block = s_dma_pool.cur;
+    s_dma_pool.cur += block_size;
+
+    return block;
+}
+
+/**
+ * !@brief Get a noncacheable, cache line aligned buffer, callable from interrupt
+ */
+void *hpm_dma_pool_alloc(rt_size_t size)
+{
+    struct dma_pool_block *block;
+    rt_base_t level;
+    int cls = dma_pool_class(size);
+
+    if ((size == 0) || (cls < 0))
+    {
+        return RT_NULL;
+    }
+
+    level = rt_hw_interrupt_disable();
+    block = s_dma_pool.free_list[cls];
+    if (block != RT_NULL)
+    {
+        s_dma_pool.free_list[cls] = block->next;
+        s_dma_pool.free_cnt[cls]--;
+    }
+    else
+    {
+        block = dma_pool_carve(cls);
+    }
+    if (block != RT_NULL)
+    {
+        s_dma_pool.used_cnt[cls]++;
+    }
+    else
+    {
+        s_dma_pool.fail_cnt++;
+    }
+    rt_hw_interrupt_enable(level);
+
+    return block;
+}
+
+/**
+ * !@brief Give a buffer back, size is the one it was allocated with
+ */
+void hpm_dma_pool_free(void *ptr, rt_size_t size)
+{
+    struct dma_pool_block *block = (struct dma_pool_block *) ptr;
+    rt_base_t level;
+    int cls = dma_pool_class(size);
+
+    if (ptr == RT_NULL)
+    {
+        return;
+    }
+    RT_ASSERT(cls >= 0);
+    RT_ASSERT(((rt_uint8_t *) ptr >= (s_dma_pool.end - BSP_DMA_POOL_SIZE)) && ((rt_uint8_t *) ptr < s_dma_pool.end));
+
+    level = rt_hw_interrupt_disable();
+    block->next = s_dma_pool.free_list[cls];
+    s_dma_pool.free_list[cls] = block;
+    s_dma_pool.free_cnt[cls]++;
+    s_dma_pool.used_cnt[cls]--;
+    rt_hw_interrupt_enable(level);
+}
+
+/**
+ * !@brief Set blocks aside at init, so a driver still gets them once the pool has been used up
+ */
+rt_err_t hpm_dma_pool_reserve(rt_size_t size, rt_uint32_t count)
+{
+    struct dma_pool_block *block;
+    rt_base_t level;
+    rt_err_t err = RT_EOK;
+    int cls = dma_pool_class(size);
+
+    if ((size == 0) || (cls < 0))
+    {
+        return -RT_EINVAL;
+    }
+
+    level = rt_hw_interrupt_disable();
+    while (count-- > 0)
+    {
+        block = (struct dma_pool_block *) dma_pool_carve(cls);
+        if (block == RT_NULL)
+        {
+            err = -RT_ENOMEM;
+            break;
+        }
+        block->next = s_dma_pool.free_list[cls];
+        s_dma_pool.free_list[cls] = block;
+        s_dma_pool.free_cnt[cls]++;
+    }
+    rt_hw_interrupt_enable(level);
+
+    if (err != RT_EOK)
+    {
+        LOG_E("reserve %d bytes blocks failed", 1UL << (DMA_POOL_MIN_SHIFT + cls));
+    }
+
+    return err;
+}
+
+int rt_hw_dma_pool_init(void)
+{
+    extern uint8_t __noncacheable_bss_end__[];
+    extern uint8_t __noncacheable_end__[];
+
+    rt_uint8_t *start = (rt_uint8_t *) HPM_L1C_CACHELINE_ALIGN_UP((uint32_t) __noncacheable_bss_end__);
+    rt_uint8_t *end = __noncacheable_end__;
+
+    if (end < start + BSP_DMA_POOL_SIZE)
+    {
+        LOG_E("noncacheable region has %d bytes left, %d wanted", end - start, BSP_DMA_POOL_SIZE);
+        return -RT_ENOMEM;
+    }
+
+    s_dma_pool.cur = start;
+    s_dma_pool.end = start + BSP_DMA_POOL_SIZE;
+
+    return RT_EOK;
+}
+INIT_PREV_EXPORT(rt_hw_dma_pool_init);
+
+static void dma_pool(int argc, char **argv)
+{
+    rt_kprintf("size       free  used\n");
+    for (rt_uint32_t cls = 0; cls < DMA_POOL_CLASS_NUM; cls++)
+    {
+        if ((s_dma_pool.free_cnt[cls] == 0) && (s_dma_pool.used_cnt[cls] == 0))
+        {
+            continue;
+        }
+        rt_kprintf("%-10u %-5u %u\n", 1UL << (DMA_POOL_MIN_SHIFT + cls), s_dma_pool.free_cnt[cls],
+                s_dma_pool.used_cnt[cls]);
+    }
+    rt_kprintf("never carved: %u bytes, failed: %u\n", s_dma_pool.end - s_dma_pool.cur, s_dma_pool.fail_cnt);
+}
+MSH_CMD_EXPORT(dma_pool, show the noncacheable dma buffer pool);
@@ -0,0 +1,30 @@
+/*
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef DRV_DMA_POOL_H
+#define DRV_DMA_POOL_H
+
+#include <rtthread.h>
+
+/*
+ * DMA buffers from the noncacheable SDRAM region, see SDRAM_NONCACHEABLE in the linker script.
+ * No cache maintenance is needed on them. Sizes are rounded up to a power of two from one
+ * cache line up to DMA_POOL_MAX_SIZE, freed blocks go back to the free list of their size.
+ */
+
+/* pool size, taken from the free part of the noncacheable region */
+#ifndef BSP_DMA_POOL_SIZE
+#define BSP_DMA_POOL_SIZE       (1024 * 1024)
+#endif
+
+#define DMA_POOL_MIN_SHIFT      (6U)    /* one cache line */
+#define DMA_POOL_CLASS_NUM      (16U)
+#define DMA_POOL_MAX_SIZE       (1UL << (DMA_POOL_MIN_SHIFT + DMA_POOL_CLASS_NUM - 1U))
+
+void *hpm_dma_pool_alloc(rt_size_t size);
+void hpm_dma_pool_free(void *ptr, rt_size_t size);
+rt_err_t hpm_dma_pool_reserve(rt_size_t size, rt_uint32_t count);
+int rt_hw_dma_pool_init(void);
+
+#endif /* DRV_DMA_POOL_H */
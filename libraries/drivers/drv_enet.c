@@ -13,14 +13,19 @@
 #ifdef BSP_USING_ETH
 #include <rtdbg.h>
 #include <netif/ethernetif.h>
+#include <stdlib.h>
 #include "board.h"
 #include "drv_enet.h"
 #include "hpm_soc_feature.h"
 #include "hpm_enet_soc_drv.h"
 #include "hpm_enet_drv.h"
+#include "hpm_l1c_drv.h"
 
 #define ETH_DEBUG
 
+/* tries to get free tx descriptors before the frame is dropped */
+#define ENET_TX_WAIT_RETRY  (10U)
+
 #ifdef BSP_USING_ETH0
 
 ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(ENET_SOC_DESC_ADDR_ALIGNMENT)
@@ -30,11 +35,15 @@ ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(ENET_SOC_DESC_ADDR_ALIGNMENT)
 __RW enet_tx_desc_t enet0_dma_tx_desc_tab[ENET0_TX_BUFF_COUNT] ; /* Ethernet0 Tx DMA Descriptor */
 
 ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(ENET_SOC_BUFF_ADDR_ALIGNMENT)
-__RW uint8_t enet0_rx_buff[ENET0_RX_BUFF_COUNT][ENET0_RX_BUFF_SIZE]; /* Ethernet0 Receive Buffer */
+__RW uint8_t enet0_rx_buff[ENET0_RX_POOL_COUNT][ENET0_RX_BUFF_SIZE]; /* Ethernet0 Receive Buffer */
 
 ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(ENET_SOC_BUFF_ADDR_ALIGNMENT)
 __RW uint8_t enet0_tx_buff[ENET0_TX_BUFF_COUNT][ENET0_TX_BUFF_SIZE]; /* Ethernet0 Transmit Buffer */
 
+static hpm_enet_rx_pbuf_t enet0_rx_pbuf[ENET0_RX_POOL_COUNT];
+static hpm_enet_rx_pbuf_t *enet0_rx_desc_pbuf[ENET0_RX_BUFF_COUNT];
+static struct pbuf *enet0_tx_desc_pbuf[ENET0_TX_BUFF_COUNT];
+
 struct eth_device eth0_dev;
 static enet_device enet0_dev;
 static enet_buff_config_t enet0_rx_buff_cfg = {.buffer = (uint32_t)enet0_rx_buff,
@@ -61,6 +70,10 @@ static hpm_enet_t enet0 = {.name            = "ETH0",
                            .enet_dev        = &enet0_dev,
                            .rx_buff_cfg     = &enet0_rx_buff_cfg,
                            .tx_buff_cfg     = &enet0_tx_buff_cfg,
+                           .rx_pbuf_tab     = enet0_rx_pbuf,
+                           .rx_pbuf_count   = ENET0_RX_POOL_COUNT,
+                           .rx_desc_pbuf    = enet0_rx_desc_pbuf,
+                           .tx_desc_pbuf    = enet0_tx_desc_pbuf,
                            .dma_rx_desc_tab = enet0_dma_rx_desc_tab,
                            .dma_tx_desc_tab = enet0_dma_tx_desc_tab,
                            .tx_delay        = BOARD_ENET0_TX_DLY,
@@ -81,11 +94,15 @@ ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(ENET_SOC_DESC_ADDR_ALIGNMENT)
 __RW enet_tx_desc_t enet1_dma_tx_desc_tab[ENET1_TX_BUFF_COUNT]; /* Ethernet1 Tx DMA Descriptor */
 
 ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(ENET_SOC_BUFF_ADDR_ALIGNMENT)
-__RW uint8_t enet1_rx_buff[ENET1_RX_BUFF_COUNT][ENET1_RX_BUFF_SIZE]; /* Ethernet1 Receive Buffer */
+__RW uint8_t enet1_rx_buff[ENET1_RX_POOL_COUNT][ENET1_RX_BUFF_SIZE]; /* Ethernet1 Receive Buffer */
 
 ATTR_PLACE_AT_NONCACHEABLE_WITH_ALIGNMENT(ENET_SOC_BUFF_ADDR_ALIGNMENT)
 __RW uint8_t enet1_tx_buff[ENET1_TX_BUFF_COUNT][ENET1_TX_BUFF_SIZE]; /* Ethernet1 Transmit Buffer */
 
+static hpm_enet_rx_pbuf_t enet1_rx_pbuf[ENET1_RX_POOL_COUNT];
+static hpm_enet_rx_pbuf_t *enet1_rx_desc_pbuf[ENET1_RX_BUFF_COUNT];
+static struct pbuf *enet1_tx_desc_pbuf[ENET1_TX_BUFF_COUNT];
+
 struct eth_device eth1_dev;
 static enet_device enet1_dev;
 static enet_buff_config_t enet1_rx_buff_cfg = {.buffer = (uint32_t)enet1_rx_buff,
@@ -112,6 +129,10 @@ static hpm_enet_t enet1 = {.name            = "ETH1",
                            .enet_dev        = &enet1_dev,
                            .rx_buff_cfg     = &enet1_rx_buff_cfg,
                            .tx_buff_cfg     = &enet1_tx_buff_cfg,
+                           .rx_pbuf_tab     = enet1_rx_pbuf,
+                           .rx_pbuf_count   = ENET1_RX_POOL_COUNT,
+                           .rx_desc_pbuf    = enet1_rx_desc_pbuf,
+                           .tx_desc_pbuf    = enet1_tx_desc_pbuf,
                            .dma_rx_desc_tab = enet1_dma_rx_desc_tab,
                            .dma_tx_desc_tab = enet1_dma_tx_desc_tab,
                            .int_refclk      = BOARD_ENET1_INT_REF_CLK,
@@ -163,6 +184,11 @@ static hpm_stat_t hpm_enet_init(enet_device *init)
        enet_set_ptp_timestamp(init->instance, &init->ptp_timestamp);
    }
 
+#ifdef BSP_ETH_USING_HW_CHECKSUM
+    /* verify IPv4 header and TCP/UDP/ICMP payload checksums of received frames */
+    init->instance->MACCFG |= ENET_MACCFG_IPC_MASK;
+#endif
+
     /* enable irq */
     intc_m_enable_irq(init->irq_number);
 }
@@ -182,6 +208,11 @@ static rt_err_t rt_hpm_eth_init(rt_device_t dev)
         LOG_D("Ethernet control initialize successfully\n");
     }
 
+#if defined(BSP_ETH_USING_HW_CHECKSUM) && LWIP_CHECKSUM_CTRL_PER_NETIF
+    /* called from netif_add(), after lwip enabled every software checksum on the netif */
+    NETIF_SET_CHECKSUM_CTRL(((struct eth_device *)dev)->netif, NETIF_CHECKSUM_DISABLE_ALL);
+#endif
+
     return RT_EOK;
 }
 
@@ -207,6 +238,7 @@ static rt_size_t rt_hpm_eth_write(rt_device_t dev, rt_off_t pos, const void * bu
 
 static rt_err_t rt_hpm_eth_control(rt_device_t dev, int cmd, void * args)
 {
+    enet_device *enet_dev = (enet_device *)dev->user_data;
     uint8_t *mac;
 
     switch (cmd)
@@ -229,6 +261,28 @@ static rt_err_t rt_hpm_eth_control(rt_device_t dev, int cmd, void * args)
             return -RT_ERROR;
         }
         break;
+    case ENET_CTRL_SET_RX_POLL_BUDGET:
+        if (args == NULL)
+        {
+            return -RT_EINVAL;
+        }
+        /* a poll in progress unmasks the rx interrupt once the ring is empty */
+        enet_dev->rx_poll_budget = *(rt_uint32_t *)args;
+        break;
+    case ENET_CTRL_GET_RX_POLL_BUDGET:
+        if (args == NULL)
+        {
+            return -RT_EINVAL;
+        }
+        *(rt_uint32_t *)args = enet_dev->rx_poll_budget;
+        break;
+    case ENET_CTRL_GET_RX_STATS:
+        if (args == NULL)
+        {
+            return -RT_EINVAL;
+        }
+        *(hpm_enet_rx_stats_t *)args = enet_dev->rx_stats;
+        break;
     default:
         break;
     }
@@ -236,78 +290,207 @@ static rt_err_t rt_hpm_eth_control(rt_device_t dev, int cmd, void * args)
     return RT_EOK;
 }
 
+/* Release the frames whose descriptors the DMA has finished with, tx_lock held */
+static void hpm_enet_tx_reclaim(enet_device *enet_dev)
+{
+    enet_tx_desc_t *dma_tx_desc = enet_dev->tx_desc_list_dirty;
+    uint32_t index;
+
+    while ((enet_dev->tx_desc_busy > 0) && (dma_tx_desc->tdes0_bm.own == 0))
+    {
+        index = dma_tx_desc - enet_dev->desc.tx_desc_list_head;
+        if (enet_dev->tx_desc_pbuf[index] != NULL)
+        {
+            pbuf_free(enet_dev->tx_desc_pbuf[index]);
+            enet_dev->tx_desc_pbuf[index] = NULL;
+        }
+        dma_tx_desc = (enet_tx_desc_t *)(dma_tx_desc->tdes3_bm.next_desc);
+        enet_dev->tx_desc_busy--;
+    }
+
+    enet_dev->tx_desc_list_dirty = dma_tx_desc;
+}
+
+static void hpm_enet_cache_writeback(void *addr, uint32_t len)
+{
+    if (l1c_dc_is_enabled())
+    {
+        uint32_t start = HPM_L1C_CACHELINE_ALIGN_DOWN((uint32_t)addr);
+        uint32_t end = HPM_L1C_CACHELINE_ALIGN_UP((uint32_t)addr + len);
+
+        l1c_dc_writeback(start, end - start);
+    }
+}
+
 static rt_err_t rt_hpm_eth_tx(rt_device_t dev, struct pbuf * p)
 {
-    rt_err_t ret = RT_ERROR;
-    uint32_t status;
     enet_device *enet_dev = (enet_device *)dev->user_data;
-    uint32_t tx_buff_size = enet_dev->desc.tx_buff_cfg.size;
+    uint32_t tx_desc_count = enet_dev->desc.tx_buff_cfg.count;
+    enet_tx_desc_t *dma_tx_desc, *first_desc, *last_desc = NULL;
     struct pbuf *q;
-    uint8_t *buffer;
-    __IO enet_tx_desc_t *dma_tx_desc;
-    uint32_t frame_length = 0;
-    uint32_t buffer_offset = 0;
-    uint32_t bytes_left_to_copy = 0;
-    uint32_t payload_offset = 0;
-    enet_tx_desc_t  *tx_desc_list_cur = enet_dev->desc.tx_desc_list_cur;
-
-    dma_tx_desc = tx_desc_list_cur;
-    buffer = (uint8_t *)(dma_tx_desc->tdes2_bm.buffer1);
-    buffer_offset = 0;
+    uint32_t seg_count = 0;
+    bool need_copy = false;
+    uint32_t retry;
 
-    /* copy frame from pbufs to driver buffers */
+    /* pbufs from ram are sent in place, rom and ref payloads are copied */
     for (q = p; q != NULL; q = q->next)
     {
-        /* Get bytes in current lwIP buffer */
-        bytes_left_to_copy = q->len;
-        payload_offset = 0;
+        if (q->len == 0)
+        {
+            continue;
+        }
+        if ((q->type != PBUF_RAM) && (q->type != PBUF_POOL))
+        {
+            need_copy = true;
+        }
+        seg_count++;
+    }
+    if (need_copy || (seg_count > tx_desc_count))
+    {
+        seg_count = 1;
+        need_copy = true;
+    }
 
-        /* Check if the length of data to copy is bigger than Tx buffer size*/
-        while ((bytes_left_to_copy + buffer_offset) > tx_buff_size)
+    for (retry = 0; ; retry++)
+    {
+        rt_mutex_take(&enet_dev->tx_lock, RT_WAITING_FOREVER);
+        hpm_enet_tx_reclaim(enet_dev);
+        if (enet_dev->tx_desc_busy + seg_count <= tx_desc_count)
+        {
+            break;
+        }
+        rt_mutex_release(&enet_dev->tx_lock);
+        if (retry >= ENET_TX_WAIT_RETRY)
         {
-            /* Copy data to Tx buffer*/
-            SMEMCPY((uint8_t *)((uint8_t *)buffer + buffer_offset),
-                    (uint8_t *)((uint8_t *)q->payload + payload_offset),
-                    tx_buff_size - buffer_offset);
+            LOG_E("DMA tx desc buffer is not valid\n");
+            return -RT_EBUSY;
+        }
+        rt_thread_delay(1);
+    }
 
-            /* Point to next descriptor */
-            dma_tx_desc = (enet_tx_desc_t *)(dma_tx_desc->tdes3_bm.next_desc);
+    first_desc = enet_dev->desc.tx_desc_list_cur;
+    dma_tx_desc = first_desc;
 
-            /* Check if the buffer is available */
-            if (dma_tx_desc->tdes0_bm.own != 0)
+    if (need_copy)
+    {
+        uint32_t index = dma_tx_desc - enet_dev->desc.tx_desc_list_head;
+        uint32_t buffer = enet_dev->desc.tx_buff_cfg.buffer + index * enet_dev->desc.tx_buff_cfg.size;
+
+        /* the descriptor's own buffer is noncacheable */
+        pbuf_copy_partial(p, (void *)buffer, p->tot_len, 0);
+        dma_tx_desc->tdes2_bm.buffer1 = buffer;
+        dma_tx_desc->tdes1_bm.tbs1 = p->tot_len;
+        last_desc = dma_tx_desc;
+        dma_tx_desc = (enet_tx_desc_t *)(dma_tx_desc->tdes3_bm.next_desc);
+    }
+    else
+    {
+        /* one descriptor per pbuf, the first one goes to the DMA last */
+        for (q = p; q != NULL; q = q->next)
+        {
+            if (q->len == 0)
             {
-                LOG_E("DMA tx desc buffer is not valid\n");
-                return ERR_USE;
+                continue;
             }
+            hpm_enet_cache_writeback(q->payload, q->len);
+            dma_tx_desc->tdes2_bm.buffer1 = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)q->payload);
+            dma_tx_desc->tdes1_bm.tbs1 = q->len;
+            dma_tx_desc->tdes0_bm.fs = 0;
+            dma_tx_desc->tdes0_bm.ls = 0;
+            last_desc = dma_tx_desc;
+            dma_tx_desc = (enet_tx_desc_t *)(dma_tx_desc->tdes3_bm.next_desc);
+        }
 
-            buffer = (uint8_t *)(dma_tx_desc->tdes2_bm.buffer1);
+        /* hold the frame until the DMA has sent it */
+        pbuf_ref(p);
+        enet_dev->tx_desc_pbuf[last_desc - enet_dev->desc.tx_desc_list_head] = p;
+    }
 
-            bytes_left_to_copy = bytes_left_to_copy - (tx_buff_size - buffer_offset);
-            payload_offset = payload_offset + (tx_buff_size - buffer_offset);
-            frame_length = frame_length + (tx_buff_size - buffer_offset);
-            buffer_offset = 0;
+    LOG_D("The length of the transmitted frame: %d\n", p->tot_len);
+
+    /* the MAC appends the FCS, the DMA reads exactly the frame bytes */
+    for (enet_tx_desc_t *desc = first_desc; desc != dma_tx_desc; desc = (enet_tx_desc_t *)(desc->tdes3_bm.next_desc))
+    {
+        desc->tdes0_bm.fs = (desc == first_desc);
+        desc->tdes0_bm.ls = (desc == last_desc);
+        desc->tdes0_bm.ic = (desc == last_desc);
+        desc->tdes0_bm.dc = 0;
+        desc->tdes0_bm.dp = 0;
+        desc->tdes0_bm.crcr = 0;
+        desc->tdes1_bm.saic = 2;
+#ifdef BSP_ETH_USING_HW_CHECKSUM
+        /* IP header and payload checksums with the pseudo-header computed by the MAC */
+        desc->tdes0_bm.cic = 3;
+#endif
+        if (desc != first_desc)
+        {
+            desc->tdes0_bm.own = 1;
         }
+    }
+    enet_dev->tx_desc_busy += seg_count;
+    enet_dev->desc.tx_desc_list_cur = dma_tx_desc;
 
-        /* Copy the remaining bytes */
-        SMEMCPY((uint8_t *)((uint8_t *)buffer + buffer_offset),
-                (uint8_t *)((uint8_t *)q->payload + payload_offset),
-                bytes_left_to_copy);
+    /* set own bit of the first descriptor: gives the frame to Ethernet DMA */
+    first_desc->tdes0_bm.own = 1;
+    enet_dev->instance->DMA_TX_POLL_DEMAND = 1;
+    rt_mutex_release(&enet_dev->tx_lock);
 
-        buffer_offset = buffer_offset + bytes_left_to_copy;
-        frame_length = frame_length + bytes_left_to_copy;
+    return RT_EOK;
+}
+
+static void hpm_enet_rx_pbuf_free(struct pbuf *p)
+{
+    hpm_enet_rx_pbuf_t *rx_pbuf = (hpm_enet_rx_pbuf_t *)p;
+    rt_base_t level;
+
+    level = rt_hw_interrupt_disable();
+    rx_pbuf->next = *rx_pbuf->free_list;
+    *rx_pbuf->free_list = rx_pbuf;
+    rt_hw_interrupt_enable(level);
+}
+
+/* Lend the received buffer to lwip and refill the descriptor with a spare one */
+static struct pbuf *hpm_enet_rx_swap(enet_device *enet_dev, enet_rx_desc_t *dma_rx_desc, uint16_t len)
+{
+    uint32_t index = dma_rx_desc - enet_dev->desc.rx_desc_list_head;
+    hpm_enet_rx_pbuf_t *spare, *full;
+    rt_base_t level;
+
+    level = rt_hw_interrupt_disable();
+    spare = enet_dev->rx_pbuf_free;
+    if (spare != NULL)
+    {
+        enet_dev->rx_pbuf_free = spare->next;
     }
+    rt_hw_interrupt_enable(level);
+
+    if (spare == NULL)
+    {
+        return NULL;
+    }
+
+    full = enet_dev->rx_desc_pbuf[index];
+    enet_dev->rx_desc_pbuf[index] = spare;
+    dma_rx_desc->rdes2_bm.buffer1 = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t)spare->buffer);
 
-    /* Prepare transmit descriptors to give to DMA */
-    LOG_D("The length of the transmitted frame: %d\n", frame_length);
+    full->pbuf.custom_free_function = hpm_enet_rx_pbuf_free;
+    return pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &full->pbuf, full->buffer, enet_dev->desc.rx_buff_cfg.size);
+}
 
-    frame_length += 4;
-    status = enet_prepare_transmission_descriptors(enet_dev->instance, &enet_dev->desc.tx_desc_list_cur, frame_length, enet_dev->desc.tx_buff_cfg.size);
-    if (status != ENET_SUCCESS)
+/* The ring is empty: back to the rx interrupt, unless a frame came in meanwhile */
+static void hpm_enet_rx_poll_done(rt_device_t dev)
+{
+    enet_device *enet_dev = (enet_device *)dev->user_data;
+
+    enet_dev->instance->DMA_STATUS = ENET_DMA_STATUS_RI_MASK;
+    if (enet_dev->desc.rx_desc_list_cur->rdes0_bm.own == 0)
     {
-        LOG_E("Ethernet controller transmit unsuccessfully: %d\n", status);
+        eth_device_ready((struct eth_device *)dev);
+        return;
     }
 
-    return ERR_OK;
+    enet_dev->rx_polling = false;
+    enet_dev->instance->DMA_INTR_EN |= ENET_DMA_INTR_EN_RIE_MASK;
 }
 
 static struct pbuf *rt_hpm_eth_rx(rt_device_t dev)
@@ -323,6 +506,24 @@ static struct pbuf *rt_hpm_eth_rx(rt_device_t dev)
     uint32_t payload_offset = 0;
     uint32_t bytes_left_to_copy = 0;
     uint32_t i = 0;
+    rt_bool_t discard = RT_FALSE;
+
+    /* the tx interrupt wakes this thread too: a quiet link must not keep sent tcp segments
+     * referenced, lwip does not retransmit a segment whose pbuf is still held by the driver */
+    rt_mutex_take(&enet_dev->tx_lock, RT_WAITING_FOREVER);
+    hpm_enet_tx_reclaim(enet_dev);
+    rt_mutex_release(&enet_dev->tx_lock);
+
+__again:
+    if (enet_dev->rx_poll_budget > 0 && enet_dev->rx_poll_count >= enet_dev->rx_poll_budget)
+    {
+        /* budget used up: queue the device again behind the other netifs, the rx interrupt stays masked */
+        enet_dev->rx_poll_count = 0;
+        enet_dev->rx_stats.budget++;
+        eth_device_ready((struct eth_device *)dev);
+        rt_thread_yield();
+        return NULL;
+    }
 
     /* Get a received frame */
     frame = enet_get_received_frame_interrupt(&enet_dev->desc.rx_desc_list_cur,
@@ -335,46 +536,70 @@ static struct pbuf *rt_hpm_eth_rx(rt_device_t dev)
 
     LOG_D("The current received frame length : %d\n", len);
 
-    if (len > 0)
+    if (len == 0)
     {
-        /* allocate a pbuf chain of pbufs from the Lwip buffer pool */
-        p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
+        enet_dev->rx_poll_count = 0;
+        if (enet_dev->rx_polling)
+        {
+            hpm_enet_rx_poll_done(dev);
+        }
+        return NULL;
     }
 
-    if (p != NULL)
+    enet_dev->rx_poll_count++;
+    enet_dev->rx_stats.frame++;
+
+#ifdef BSP_ETH_USING_HW_CHECKSUM
+    /* lwip does not verify checksums anymore: drop what the MAC flagged (CRC, IP header or payload checksum) */
+    if (enet_dev->desc.rx_frame_info.ls_rx_desc->rdes0_bm.es)
     {
-        dma_rx_desc = frame.rx_desc;
-        buffer_offset = 0;
-        for (q = p; q != NULL; q = q->next)
-        {
-            bytes_left_to_copy = q->len;
-            payload_offset = 0;
+        LOG_D("drop the received frame, status: 0x%08x\n", enet_dev->desc.rx_frame_info.ls_rx_desc->rdes0);
+        discard = RT_TRUE;
+    }
+#endif
 
-            /* Check if the length of bytes to copy in current pbuf is bigger than Rx buffer size*/
-            while ((bytes_left_to_copy + buffer_offset) > rx_buff_size)
-            {
-                /* Copy data to pbuf */
-                SMEMCPY((uint8_t *)((uint8_t *)q->payload + payload_offset), (uint8_t *)((uint8_t *)buffer + buffer_offset), (rx_buff_size - buffer_offset));
+    /* a frame in one buffer goes up as is while spare buffers are left */
+    if (!discard && enet_dev->desc.rx_frame_info.seg_count == 1)
+    {
+        p = hpm_enet_rx_swap(enet_dev, frame.rx_desc, len);
+    }
 
-                /* Point to next descriptor */
-                dma_rx_desc = (enet_rx_desc_t *)(dma_rx_desc->rdes3_bm.next_desc);
-                buffer = (uint8_t *)(dma_rx_desc->rdes2_bm.buffer1);
+    if (!discard && p == NULL)
+    {
+        /* allocate a pbuf chain of pbufs from the Lwip buffer pool */
+        p = pbuf_alloc(PBUF_RAW, len, PBUF_POOL);
 
-                bytes_left_to_copy = bytes_left_to_copy - (rx_buff_size - buffer_offset);
-                payload_offset = payload_offset + (rx_buff_size - buffer_offset);
-                buffer_offset = 0;
+        if (p != NULL)
+        {
+            dma_rx_desc = frame.rx_desc;
+            buffer_offset = 0;
+            for (q = p; q != NULL; q = q->next)
+            {
+                bytes_left_to_copy = q->len;
+                payload_offset = 0;
+
+                /* Check if the length of bytes to copy in current pbuf is bigger than Rx buffer size*/
+                while ((bytes_left_to_copy + buffer_offset) > rx_buff_size)
+                {
+                    /* Copy data to pbuf */
+                    SMEMCPY((uint8_t *)((uint8_t *)q->payload + payload_offset), (uint8_t *)((uint8_t *)buffer + buffer_offset), (rx_buff_size - buffer_offset));
+
+                    /* Point to next descriptor */
+                    dma_rx_desc = (enet_rx_desc_t *)(dma_rx_desc->rdes3_bm.next_desc);
+                    buffer = (uint8_t *)(dma_rx_desc->rdes2_bm.buffer1);
+
+                    bytes_left_to_copy = bytes_left_to_copy - (rx_buff_size - buffer_offset);
+                    payload_offset = payload_offset + (rx_buff_size - buffer_offset);
+                    buffer_offset = 0;
+                }
+                /* Copy remaining data in pbuf */
+                SMEMCPY((uint8_t *)((uint8_t *)q->payload + payload_offset), (uint8_t *)((uint8_t *)buffer + buffer_offset), bytes_left_to_copy);
+                buffer_offset = buffer_offset + bytes_left_to_copy;
             }
-            /* Copy remaining data in pbuf */
-            SMEMCPY((uint8_t *)((uint8_t *)q->payload + payload_offset), (uint8_t *)((uint8_t *)buffer + buffer_offset), bytes_left_to_copy);
-            buffer_offset = buffer_offset + bytes_left_to_copy;
         }
     }
-    else
-    {
-        return NULL;
-    }
 
-    /* Release descriptors to DMA */
+    /* Release descriptors to DMA, the frame is dropped when no pbuf was available */
     /* Point to first descriptor */
     dma_rx_desc = frame.rx_desc;
 
@@ -388,6 +613,13 @@ static struct pbuf *rt_hpm_eth_rx(rt_device_t dev)
     /* Clear Segment_Count */
     enet_dev->desc.rx_frame_info.seg_count = 0;
 
+    if (discard)
+    {
+        /* the rx thread stops at the first NULL, look at the next frame */
+        discard = RT_FALSE;
+        goto __again;
+    }
+
     return p;
 }
 
@@ -411,8 +643,20 @@ void isr_enet(hpm_enet_t *obj)
         obj->base->DMA_STATUS |= ENET_DMA_STATUS_GLPII_SET(ENET_DMA_STATUS_GLPII_GET(status));
     }
 
+    if (ENET_DMA_STATUS_TI_GET(status)) {
+        /* the sent frames are released by the eth thread, see rt_hpm_eth_rx() */
+        obj->base->DMA_STATUS = ENET_DMA_STATUS_TI_MASK | ENET_DMA_STATUS_NIS_MASK;
+        eth_rx_callback(obj->eth_dev);
+    }
+
     if (ENET_DMA_STATUS_RI_GET(status)) {
         obj->base->DMA_STATUS |= ENET_DMA_STATUS_RI_SET(ENET_DMA_STATUS_RI_GET(status));
+        obj->enet_dev->rx_stats.irq++;
+        if (obj->enet_dev->rx_poll_budget > 0) {
+            /* the eth thread drains the ring, see hpm_enet_rx_poll_done() */
+            obj->base->DMA_INTR_EN &= ~ENET_DMA_INTR_EN_RIE_MASK;
+            obj->enet_dev->rx_polling = true;
+        }
         eth_rx_callback(obj->eth_dev);
     }
 }
@@ -458,6 +702,39 @@ int rt_hw_eth_init(void)
         s_geths[i]->enet_dev->desc.rx_buff_cfg.count = s_geths[i]->rx_buff_cfg->count;
         s_geths[i]->enet_dev->desc.rx_buff_cfg.size = s_geths[i]->rx_buff_cfg->size;
 
+        /* The first rx buffers belong to the descriptors, the rest are spares */
+        s_geths[i]->enet_dev->rx_desc_pbuf = s_geths[i]->rx_desc_pbuf;
+        s_geths[i]->enet_dev->rx_pbuf_free = NULL;
+        for (uint32_t j = 0; j < s_geths[i]->rx_pbuf_count; j++)
+        {
+            hpm_enet_rx_pbuf_t *rx_pbuf = &s_geths[i]->rx_pbuf_tab[j];
+
+            rx_pbuf->buffer = (uint8_t *)s_geths[i]->rx_buff_cfg->buffer + j * s_geths[i]->rx_buff_cfg->size;
+            rx_pbuf->free_list = &s_geths[i]->enet_dev->rx_pbuf_free;
+            if (j < s_geths[i]->rx_buff_cfg->count)
+            {
+                s_geths[i]->rx_desc_pbuf[j] = rx_pbuf;
+            }
+            else
+            {
+                rx_pbuf->next = s_geths[i]->enet_dev->rx_pbuf_free;
+                s_geths[i]->enet_dev->rx_pbuf_free = rx_pbuf;
+            }
+        }
+
+        /* Tx frames are freed once their descriptors complete */
+        memset(s_geths[i]->tx_desc_pbuf, 0x00, sizeof(struct pbuf *) * s_geths[i]->tx_buff_cfg->count);
+        s_geths[i]->enet_dev->tx_desc_pbuf = s_geths[i]->tx_desc_pbuf;
+        s_geths[i]->enet_dev->tx_desc_list_dirty = s_geths[i]->enet_dev->desc.tx_desc_list_head;
+        s_geths[i]->enet_dev->tx_desc_busy = 0;
+        rt_mutex_init(&s_geths[i]->enet_dev->tx_lock, s_geths[i]->name, RT_IPC_FLAG_PRIO);
+
+        /* Rx interrupt masked while the eth thread polls the ring */
+        s_geths[i]->enet_dev->rx_poll_budget = ENET_RX_POLL_BUDGET;
+        s_geths[i]->enet_dev->rx_poll_count = 0;
+        s_geths[i]->enet_dev->rx_polling = false;
+        memset(&s_geths[i]->enet_dev->rx_stats, 0x00, sizeof(hpm_enet_rx_stats_t));
+
         /* Set mac0 address */
         s_geths[i]->enet_dev->mac_config.mac_addr_high[0] = MAC_ADDR5 << 8 | MAC_ADDR4;
         s_geths[i]->enet_dev->mac_config.mac_addr_low[0] = MAC_ADDR3 << 24 | MAC_ADDR2 << 16 | MAC_ADDR1 << 8 | MAC_ADDR0;
@@ -485,7 +762,8 @@ int rt_hw_eth_init(void)
 
         /* Set the interrupt enable mask */
         s_geths[i]->enet_dev->mask = ENET_DMA_INTR_EN_NIE_SET(1)   /* Enable normal interrupt summary */
-                                   | ENET_DMA_INTR_EN_RIE_SET(1);  /* Enable receive interrupt */
+                                   | ENET_DMA_INTR_EN_RIE_SET(1)   /* Enable receive interrupt */
+                                   | ENET_DMA_INTR_EN_TIE_SET(1);  /* Enable transmit interrupt */
 
         /* Set the interrupt disable mask */
         s_geths[i]->enet_dev->dis_mask = ENET_INTR_MASK_RGSMIIIM_SET(1);
@@ -523,6 +801,37 @@ int rt_hw_eth_init(void)
     return err;
 
 }
-INIT_DEVICE_EXPORT(rt_hw_eth_init);
+
+static void enet_rx_poll(int argc, char **argv)
+{
+    hpm_enet_rx_stats_t stats;
+    rt_uint32_t budget;
+    rt_device_t dev;
+
+    if (argc < 2)
+    {
+        rt_kprintf("usage: enet_rx_poll <ETH0|ETH1> [budget]\n");
+        return;
+    }
+
+    dev = rt_device_find(argv[1]);
+    if (dev == RT_NULL || dev->control != rt_hpm_eth_control)
+    {
+        rt_kprintf("%s is not an enet device\n", argv[1]);
+        return;
+    }
+
+    if (argc > 2)
+    {
+        budget = atoi(argv[2]);
+        rt_device_control(dev, ENET_CTRL_SET_RX_POLL_BUDGET, &budget);
+    }
+
+    rt_device_control(dev, ENET_CTRL_GET_RX_POLL_BUDGET, &budget);
+    rt_device_control(dev, ENET_CTRL_GET_RX_STATS, &stats);
+    rt_kprintf("budget: %u\n", budget);
+    rt_kprintf("irq: %u, frame: %u, budget used up: %u\n", stats.irq, stats.frame, stats.budget);
+}
+MSH_CMD_EXPORT(enet_rx_poll, show or set the enet rx poll budget);
 #endif /* BSP_USING_ETH */
 
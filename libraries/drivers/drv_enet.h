@@ -9,9 +9,35 @@
 #define DRV_ENET_H
 
 #include <netif/ethernetif.h>
-#include "../../applications/inc/netconf.h"
 #include "hpm_enet_drv.h"
 
+/* MAC address, override from the build to give each board its own */
+#ifndef MAC_ADDR0
+#define MAC_ADDR0   0x98
+#define MAC_ADDR1   0x2C
+#define MAC_ADDR2   0xBC
+#define MAC_ADDR3   0xB1
+#define MAC_ADDR4   0x9F
+#define MAC_ADDR5   0x17
+#endif
+
+/* rx buffer lent to lwip as a custom pbuf, back on the free list when lwip frees it */
+typedef struct _hpm_enet_rx_pbuf
+{
+    struct pbuf_custom pbuf;
+    struct _hpm_enet_rx_pbuf *next;
+    struct _hpm_enet_rx_pbuf **free_list;
+    uint8_t *buffer;
+} hpm_enet_rx_pbuf_t;
+
+/* rx counters, read with ENET_CTRL_GET_RX_STATS */
+typedef struct
+{
+    uint32_t irq;                        /* rx interrupts taken */
+    uint32_t frame;                      /* frames taken from the ring */
+    uint32_t budget;                     /* polls cut short by the budget */
+} hpm_enet_rx_stats_t;
+
 typedef struct {
     ENET_Type * instance;
     enet_desc_t desc;
@@ -27,6 +53,16 @@ typedef struct {
     uint32_t ptp_clk_src;
     enet_ptp_config_t ptp_config;
     enet_ptp_time_t ptp_timestamp;
+    hpm_enet_rx_pbuf_t **rx_desc_pbuf;   /* buffer owned by each rx descriptor */
+    hpm_enet_rx_pbuf_t *rx_pbuf_free;    /* spare rx buffers */
+    struct pbuf **tx_desc_pbuf;          /* frame released when the tx descriptor completes */
+    enet_tx_desc_t *tx_desc_list_dirty;  /* oldest tx descriptor not reclaimed */
+    uint32_t tx_desc_busy;
+    struct rt_mutex tx_lock;             /* tx ring, shared by the tx path and the rx thread reclaim */
+    uint32_t rx_poll_budget;             /* frames per poll with the rx interrupt masked, 0: interrupt driven */
+    uint32_t rx_poll_count;              /* frames taken in the current poll */
+    volatile bool rx_polling;            /* rx interrupt masked until the ring is empty */
+    hpm_enet_rx_stats_t rx_stats;
 } enet_device;
 
 typedef struct _hpm_enet
@@ -40,6 +76,10 @@ typedef struct _hpm_enet
     enet_device *enet_dev;
     enet_buff_config_t *rx_buff_cfg;
     enet_buff_config_t *tx_buff_cfg;
+    hpm_enet_rx_pbuf_t *rx_pbuf_tab;
+    uint32_t rx_pbuf_count;
+    hpm_enet_rx_pbuf_t **rx_desc_pbuf;
+    struct pbuf **tx_desc_pbuf;
     volatile enet_rx_desc_t *dma_rx_desc_tab;
     volatile enet_tx_desc_t *dma_tx_desc_tab;
     uint8_t tx_delay;
@@ -59,6 +99,11 @@ typedef struct _hpm_enet
 #define ENET0_RX_BUFF_COUNT  (20U)
 #endif
 
+/* rx buffers in the pool, the ones beyond the descriptors refill them while lwip holds frames */
+#ifndef ENET0_RX_POOL_COUNT
+#define ENET0_RX_POOL_COUNT (ENET0_RX_BUFF_COUNT * 2)
+#endif
+
 #ifndef ENET0_RX_BUFF_SIZE
 #define ENET0_RX_BUFF_SIZE   ENET_MAX_FRAME_SIZE
 #endif
@@ -75,6 +120,11 @@ typedef struct _hpm_enet
 #define ENET1_RX_BUFF_COUNT  (20U)
 #endif
 
+/* rx buffers in the pool, the ones beyond the descriptors refill them while lwip holds frames */
+#ifndef ENET1_RX_POOL_COUNT
+#define ENET1_RX_POOL_COUNT (ENET1_RX_BUFF_COUNT * 2)
+#endif
+
 #ifndef ENET1_RX_BUFF_SIZE
 #define ENET1_RX_BUFF_SIZE   ENET_MAX_FRAME_SIZE
 #endif
@@ -83,6 +133,17 @@ typedef struct _hpm_enet
 #define ENET1_TX_BUFF_SIZE   ENET_MAX_FRAME_SIZE
 #endif
 
+/* frames the eth thread drains per wakeup before it lets the other netifs and threads run */
+#ifndef ENET_RX_POLL_BUDGET
+#define ENET_RX_POLL_BUDGET  (16U)
+#endif
+
+/* rt_device_control() commands */
+#define ENET_CTRL_SET_RX_POLL_BUDGET  (0x20)  /* args: rt_uint32_t *, 0 goes back to one wakeup per interrupt */
+#define ENET_CTRL_GET_RX_POLL_BUDGET  (0x21)  /* args: rt_uint32_t * */
+#define ENET_CTRL_GET_RX_STATS        (0x22)  /* args: hpm_enet_rx_stats_t * */
+
+/* not an init export, the application calls it once it needs the network */
 int rt_hw_eth_init(void);
 
 #endif /* DRV_ENET_H */
@@ -15,6 +15,8 @@
 #include "board.h"
 #include "hpm_sdxc_drv.h"
 #include "hpm_l1c_drv.h"
+#include "drv_dma_pool.h"
+#include <stdlib.h>
 
 #define DBG_TAG "drv.sdio"
 #define DBG_LVL -1
@@ -22,14 +24,34 @@
 
 
 #define CACHE_LINESIZE                  HPM_L1C_CACHELINE_SIZE
-#define SDXC_ADMA_TABLE_WORDS           (2U)
+#define SDXC_ADMA2_DESC_NUM             (32U)
+#define SDXC_ADMA_TABLE_WORDS           (SDXC_ADMA2_DESC_NUM * sizeof(sdxc_adma2_descriptor_t) / sizeof(uint32_t))
+#define SDXC_ADMA2_DESC_MAX_LEN         (0x10000UL - 4U)
+/* one descriptor each is kept for the head and tail line of an unaligned read */
+#define SDXC_ADMA2_MAX_SEGS             (SDXC_ADMA2_DESC_NUM - 2U)
+#define SDXC_MAX_BLK_COUNT              (SDXC_ADMA2_MAX_SEGS * SDXC_ADMA2_DESC_MAX_LEN / 512U)
 #define SDXC_AMDA2_ADDR_ALIGN           (4U)
+#define SDXC_XFER_TIMEOUT_MS            (3000U)
+/* bounce buffer kept in the dma pool for buffers that are not word aligned, larger ones come from the heap */
+#define SDXC_BOUNCE_RESERVE_SIZE        (64U * 1024U)
 #define SDXC_DATA_TIMEOUT               (0xFU)
+#define SDXC_UHS_FREQ_MAX               (208000000UL)
+#define SDXC_1V8_SETTLE_MS              (5U)
+/* the host gives up tuning after 40 tuning blocks */
+#define SDXC_TUNING_MAX_LOOPS           (40U)
+#define SDXC_TUNING_BLOCK_TIMEOUT_MS    (10U)
 
 #define SDXC_CACHELINE_ALIGN_DOWN(x)    ((uint32_t)(x) & ~((uint32_t)(CACHE_LINESIZE) - 1UL))
 #define SDXC_CACHELINE_ALIGN_UP(x)      SDXC_CACHELINE_ALIGN_DOWN((uint32_t)(x) + (uint32_t)(CACHE_LINESIZE) - 1U)
 #define SDXC_IS_CACHELINE_ALIGNED(n)    ((uint32_t)(n) % (uint32_t)(CACHE_LINESIZE) == 0U)
 
+/* interrupts that end a data command, the data itself or an error on either */
+#define SDXC_XFER_SIGNAL_MASK           (SDXC_INT_STAT_XFER_COMPLETE_MASK | SDXC_INT_STAT_CMD_TOUT_ERR_MASK \
+                                         | SDXC_INT_STAT_CMD_CRC_ERR_MASK | SDXC_INT_STAT_CMD_END_BIT_ERR_MASK \
+                                         | SDXC_INT_STAT_CMD_IDX_ERR_MASK | SDXC_INT_STAT_DATA_TOUT_ERR_MASK \
+                                         | SDXC_INT_STAT_DATA_CRC_ERR_MASK | SDXC_INT_STAT_DATA_END_BIT_ERR_MASK \
+                                         | SDXC_INT_STAT_AUTO_CMD_ERR_MASK | SDXC_INT_STAT_ADMA_ERR_MASK)
+
 struct hpm_mmcsd
 {
     struct rt_mmcsd_host *host;
@@ -42,12 +64,27 @@ struct hpm_mmcsd
 
     SDXC_Type *sdxc_base;
     int32_t irq_num;
-    uint32_t *sdxc_adma2_table;
+    sdxc_adma2_descriptor_t *sdxc_adma2_table;
+    uint32_t adma2_used;
+
+    uint32_t *bounce_buf;       /* whole request copy, buffer not word aligned */
+    bool bounce_in_pool;        /* bounce_buf is noncacheable from the dma pool, else cacheable from the heap */
+    uint32_t head_len;          /* read bytes received in s_sdxc_bounce_line[0] */
+    uint32_t tail_len;          /* read bytes received in s_sdxc_bounce_line[1] */
+    rt_uint32_t data_reqs;
+
+    rt_sem_t xfer_sem;          /* released by the SDXC interrupt at the end of a data command */
+    volatile uint32_t xfer_int_stat;
+
+    uint32_t actual_clock;      /* card clock the board could set, Hz */
+    bool use_tuning_sdr50;      /* the host wants tuning in SDR50 as well as SDR104 */
 };
 
 static void hpm_sdmmc_request(struct rt_mmcsd_host *host, struct rt_mmcsd_req *req);
 static void hpm_sdmmc_set_iocfg(struct rt_mmcsd_host *host, struct rt_mmcsd_io_cfg *io_cfg);
 static void hpm_sdmmc_enable_sdio_irq(struct rt_mmcsd_host *host, rt_int32_t en);
+static rt_int32_t hpm_sdmmc_execute_tuning(struct rt_mmcsd_host *host, rt_int32_t opcode);
+static rt_int32_t hpm_sdmmc_switch_uhs_voltage(struct rt_mmcsd_host *host);
 static void hpm_sdmmc_host_recovery(SDXC_Type *base);
 
 static const struct rt_mmcsd_host_ops hpm_mmcsd_host_ops =
@@ -56,10 +93,372 @@ static const struct rt_mmcsd_host_ops hpm_mmcsd_host_ops =
     .set_iocfg = hpm_sdmmc_set_iocfg,
     .get_card_status = NULL,
     .enable_sdio_irq = NULL, // Do not use the interrupt mode, use DMA instead
+    .execute_tuning = hpm_sdmmc_execute_tuning,
+    .switch_uhs_voltage = hpm_sdmmc_switch_uhs_voltage,
 };
 
 /* Place the ADMA2 table to non-cacheable region */
-ATTR_PLACE_AT_NONCACHEABLE static uint32_t s_sdxc_adma2_table[SDXC_ADMA_TABLE_WORDS];
+ATTR_PLACE_AT_NONCACHEABLE static sdxc_adma2_descriptor_t s_sdxc_adma2_table[SDXC_ADMA2_DESC_NUM];
+/* Cache lines a read buffer only partly covers are received here, see hpm_sdmmc_map_data() */
+ATTR_PLACE_AT_NONCACHEABLE static uint32_t s_sdxc_bounce_line[2][CACHE_LINESIZE / sizeof(uint32_t)];
+
+static struct hpm_mmcsd *s_hpm_mmcsd;
+
+/**
+ * !@brief Start a new descriptor chain
+ */
+static void hpm_sdmmc_adma2_reset(struct hpm_mmcsd *mmcsd)
+{
+    mmcsd->adma2_used = 0;
+}
+
+/**
+ * !@brief Append a buffer to the chain, split into as many descriptors as it needs
+ */
+static rt_err_t hpm_sdmmc_adma2_append(struct hpm_mmcsd *mmcsd, const void *buf, uint32_t len)
+{
+    uint32_t addr = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) buf);
+
+    RT_ASSERT(addr % SDXC_AMDA2_ADDR_ALIGN == 0U);
+
+    while (len > 0U)
+    {
+        uint32_t seg_len = (len > SDXC_ADMA2_DESC_MAX_LEN) ? SDXC_ADMA2_DESC_MAX_LEN : len;
+        sdxc_adma2_descriptor_t *desc;
+
+        if (mmcsd->adma2_used >= SDXC_ADMA2_DESC_NUM)
+        {
+            LOG_E("adma2 table full\n");
+            return -RT_EFULL;
+        }
+        desc = &mmcsd->sdxc_adma2_table[mmcsd->adma2_used++];
+        desc->len_attr = 0U;
+        desc->len_lower = seg_len;
+        desc->act = SDXC_ADMA2_DESC_TYPE_TRANS;
+        desc->valid = 1U;
+        desc->addr = (const uint32_t *) addr;
+
+        addr += seg_len;
+        len -= seg_len;
+    }
+
+    return RT_EOK;
+}
+
+/**
+ * !@brief Mark the last descriptor, the chain is ready for the controller
+ */
+static rt_err_t hpm_sdmmc_adma2_finish(struct hpm_mmcsd *mmcsd)
+{
+    if (mmcsd->adma2_used == 0U)
+    {
+        return -RT_EINVAL;
+    }
+    mmcsd->sdxc_adma2_table[mmcsd->adma2_used - 1U].end = 1U;
+
+    return RT_EOK;
+}
+
+/**
+ * !@brief Get a bounce buffer, the dma pool up to SDXC_BOUNCE_RESERVE_SIZE, the heap above it or when the pool is out
+ */
+static rt_err_t hpm_sdmmc_bounce_alloc(struct hpm_mmcsd *mmcsd, uint32_t size)
+{
+    mmcsd->bounce_buf = NULL;
+    mmcsd->bounce_in_pool = false;
+    if (size <= SDXC_BOUNCE_RESERVE_SIZE)
+    {
+        mmcsd->bounce_buf = (uint32_t *) hpm_dma_pool_alloc(size);
+        mmcsd->bounce_in_pool = (mmcsd->bounce_buf != NULL);
+    }
+    if (mmcsd->bounce_buf == NULL)
+    {
+        mmcsd->bounce_buf = (uint32_t *) rt_malloc_align(SDXC_CACHELINE_ALIGN_UP(size), CACHE_LINESIZE);
+    }
+    if (mmcsd->bounce_buf == NULL)
+    {
+        LOG_E("allocate %d bytes bounce buffer failed\n", size);
+        return -RT_ENOMEM;
+    }
+
+    return RT_EOK;
+}
+
+static void hpm_sdmmc_bounce_free(struct hpm_mmcsd *mmcsd, uint32_t size)
+{
+    if (mmcsd->bounce_in_pool)
+    {
+        hpm_dma_pool_free(mmcsd->bounce_buf, size);
+    }
+    else
+    {
+        rt_free_align(mmcsd->bounce_buf);
+    }
+    mmcsd->bounce_buf = NULL;
+    mmcsd->bounce_in_pool = false;
+}
+
+/**
+ * !@brief Build the descriptor chain for a data request and do the cache maintenance
+ *
+ * The buffer is handed to the DMA in place. Only a buffer that is not word aligned is copied
+ * through a bounce buffer, see hpm_sdmmc_bounce_alloc(). For reads, the cache lines at both ends the buffer only partly
+ * covers can't be invalidated without losing the data next to it, they are received into
+ * s_sdxc_bounce_line and copied out in hpm_sdmmc_unmap_data().
+ */
+static rt_err_t hpm_sdmmc_map_data(struct hpm_mmcsd *mmcsd, struct rt_mmcsd_data *data)
+{
+    uint32_t size = data->blks * data->blksize;
+    uint32_t addr = (uint32_t) data->buf;
+    uint32_t end = addr + size;
+    bool is_write = (data->flags & DATA_DIR_WRITE) != 0U;
+    rt_err_t err;
+
+    hpm_sdmmc_adma2_reset(mmcsd);
+    mmcsd->bounce_buf = NULL;
+    mmcsd->head_len = 0;
+    mmcsd->tail_len = 0;
+
+    if (addr % SDXC_AMDA2_ADDR_ALIGN != 0U)
+    {
+        err = hpm_sdmmc_bounce_alloc(mmcsd, size);
+        if (err != RT_EOK)
+        {
+            return err;
+        }
+        if (is_write)
+        {
+            memcpy(mmcsd->bounce_buf, data->buf, size);
+        }
+        if (!mmcsd->bounce_in_pool)
+        {
+            /* the heap buffer is whole cache lines, none of them shared with other data */
+            rt_enter_critical();
+            if (is_write)
+            {
+                l1c_dc_writeback((uint32_t) mmcsd->bounce_buf, SDXC_CACHELINE_ALIGN_UP(size));
+            }
+            else
+            {
+                l1c_dc_invalidate((uint32_t) mmcsd->bounce_buf, SDXC_CACHELINE_ALIGN_UP(size));
+            }
+            rt_exit_critical();
+        }
+
+        err = hpm_sdmmc_adma2_append(mmcsd, mmcsd->bounce_buf, size);
+        return (err == RT_EOK) ? hpm_sdmmc_adma2_finish(mmcsd) : err;
+    }
+
+    if (is_write)
+    {
+        /* writing back whole lines leaves the data around the buffer alone */
+        rt_enter_critical();
+        l1c_dc_writeback(SDXC_CACHELINE_ALIGN_DOWN(addr), SDXC_CACHELINE_ALIGN_UP(end) - SDXC_CACHELINE_ALIGN_DOWN(addr));
+        rt_exit_critical();
+
+        err = hpm_sdmmc_adma2_append(mmcsd, data->buf, size);
+        return (err == RT_EOK) ? hpm_sdmmc_adma2_finish(mmcsd) : err;
+    }
+
+    if (!SDXC_IS_CACHELINE_ALIGNED(addr))
+    {
+        mmcsd->head_len = SDXC_CACHELINE_ALIGN_UP(addr) - addr;
+        if (mmcsd->head_len > size)
+        {
+            mmcsd->head_len = size;
+        }
+    }
+    if (!SDXC_IS_CACHELINE_ALIGNED(end) && (size > mmcsd->head_len))
+    {
+        mmcsd->tail_len = end - SDXC_CACHELINE_ALIGN_DOWN(end);
+    }
+
+    uint32_t body_addr = addr + mmcsd->head_len;
+    uint32_t body_len = size - mmcsd->head_len - mmcsd->tail_len;
+
+    err = hpm_sdmmc_adma2_append(mmcsd, s_sdxc_bounce_line[0], mmcsd->head_len);
+    if (err == RT_EOK)
+    {
+        err = hpm_sdmmc_adma2_append(mmcsd, (void *) body_addr, body_len);
+    }
+    if (err == RT_EOK)
+    {
+        err = hpm_sdmmc_adma2_append(mmcsd, s_sdxc_bounce_line[1], mmcsd->tail_len);
+    }
+    if (err != RT_EOK)
+    {
+        return err;
+    }
+
+    if (body_len > 0U)
+    {
+        /* dirty lines must not be evicted on top of what the DMA writes */
+        rt_enter_critical();
+        l1c_dc_invalidate(body_addr, body_len);
+        rt_exit_critical();
+    }
+
+    return hpm_sdmmc_adma2_finish(mmcsd);
+}
+
+/**
+ * !@brief Copy received data out of the bounce buffers and release them
+ */
+static void hpm_sdmmc_unmap_data(struct hpm_mmcsd *mmcsd, struct rt_mmcsd_data *data, bool success)
+{
+    uint32_t size = data->blks * data->blksize;
+    uint8_t *buf = (uint8_t *) data->buf;
+
+    if (success && ((data->flags & DATA_DIR_WRITE) == 0U))
+    {
+        if (mmcsd->bounce_buf != NULL)
+        {
+            if (!mmcsd->bounce_in_pool)
+            {
+                rt_enter_critical();
+                l1c_dc_invalidate((uint32_t) mmcsd->bounce_buf, SDXC_CACHELINE_ALIGN_UP(size));
+                rt_exit_critical();
+            }
+            memcpy(buf, mmcsd->bounce_buf, size);
+        }
+        else
+        {
+            uint32_t body_len = size - mmcsd->head_len - mmcsd->tail_len;
+            if (body_len > 0U)
+            {
+                rt_enter_critical();
+                l1c_dc_invalidate((uint32_t) buf + mmcsd->head_len, body_len);
+                rt_exit_critical();
+            }
+            memcpy(buf, s_sdxc_bounce_line[0], mmcsd->head_len);
+            memcpy(buf + size - mmcsd->tail_len, s_sdxc_bounce_line[1], mmcsd->tail_len);
+        }
+    }
+
+    if (mmcsd->bounce_buf != NULL)
+    {
+        hpm_sdmmc_bounce_free(mmcsd, size);
+    }
+}
+
+static void hpm_sdmmc_isr(struct hpm_mmcsd *mmcsd)
+{
+    SDXC_Type *base = mmcsd->sdxc_base;
+    uint32_t int_stat = sdxc_get_interrupt_status(base);
+
+    if ((int_stat & SDXC_XFER_SIGNAL_MASK) != 0U)
+    {
+        /* status is left for the thread to check and clear */
+        sdxc_enable_interrupt_signal(base, SDXC_XFER_SIGNAL_MASK, false);
+        mmcsd->xfer_int_stat = int_stat;
+        rt_sem_release(mmcsd->xfer_sem);
+    }
+}
+
+void sdxc_isr(void)
+{
+    hpm_sdmmc_isr(s_hpm_mmcsd);
+}
+SDK_DECLARE_EXT_ISR_M(BOARD_APP_SDCARD_SDXC_IRQ, sdxc_isr)
+
+/**
+ * !@brief The card ends a multiple block transfer by itself after CMD23
+ */
+static bool hpm_sdmmc_card_has_cmd23(struct rt_mmcsd_host *host)
+{
+    struct rt_mmcsd_card *card = host->card;
+
+    if (card == RT_NULL)
+    {
+        return false;
+    }
+    if (card->card_type == CARD_TYPE_MMC)
+    {
+        return true;
+    }
+    /* SCR CMD_SUPPORT, bit 33 */
+    return (card->card_type == CARD_TYPE_SD) && ((card->resp_scr[0] & (1UL << 1)) != 0U);
+}
+
+/**
+ * !@brief Send a data command and move the data with the prepared ADMA2 chain
+ *
+ * Same register sequence as sdxc_transfer_blocking(), which can only describe a single contiguous
+ * buffer. A memory CMD18/CMD25 is bounded by auto CMD23 when the card has it, else ended by
+ * auto CMD12. The thread sleeps on xfer_sem until the transfer completes or fails.
+ */
+static hpm_stat_t hpm_sdmmc_transfer_data(struct hpm_mmcsd *mmcsd, sdxc_command_t *cmd, struct rt_mmcsd_data *data)
+{
+    SDXC_Type *base = mmcsd->sdxc_base;
+    sdxc_adma_config_t adma_config = { 0 };
+    uint32_t int_stat;
+    hpm_stat_t err;
+
+    if ((sdxc_get_present_status(base) & (SDXC_PSTATE_CMD_INHIBIT_MASK | SDXC_PSTATE_DAT_INHIBIT_MASK)) != 0U)
+    {
+        return status_sdxc_busy;
+    }
+
+    adma_config.dma_type = sdxc_dmasel_adma2;
+    adma_config.adma_table = (uint32_t*) core_local_mem_to_sys_address(BOARD_RUNNING_CORE,
+            (uint32_t) mmcsd->sdxc_adma2_table);
+    adma_config.adma_table_words = SDXC_ADMA_TABLE_WORDS;
+    sdxc_set_dma_config(base, &adma_config, NULL, false);
+
+    base->BLK_ATTR = data->blksize;
+    base->SDMASA = data->blks;
+
+    cmd->cmd_flags = SDXC_CMD_XFER_DATA_PRESENT_SEL_MASK | SDXC_CMD_XFER_DMA_ENABLE_MASK;
+    if ((data->flags & DATA_DIR_WRITE) == 0U)
+    {
+        cmd->cmd_flags |= SDXC_CMD_XFER_DATA_XFER_DIR_MASK;
+    }
+    if (data->blks > 1U)
+    {
+        cmd->cmd_flags |= SDXC_CMD_XFER_MULTI_BLK_SEL_MASK | SDXC_CMD_XFER_BLOCK_COUNT_ENABLE_MASK;
+        /* SDIO CMD53 ends on its block count and aborts with CMD52, the auto commands are for memory only */
+        bool is_memory = (cmd->cmd_index == READ_MULTIPLE_BLOCK) || (cmd->cmd_index == WRITE_MULTIPLE_BLOCK);
+        if (is_memory && hpm_sdmmc_card_has_cmd23(mmcsd->host))
+        {
+            cmd->cmd_flags |= SDXC_CMD_XFER_AUTO_CMD_ENABLE_SET(sdxc_auto_cmd23_enabled);
+        }
+        else if (is_memory)
+        {
+            cmd->cmd_flags |= SDXC_CMD_XFER_AUTO_CMD_ENABLE_SET(sdxc_auto_cmd12_enabled);
+        }
+    }
+
+    rt_sem_control(mmcsd->xfer_sem, RT_IPC_CMD_RESET, RT_NULL);
+    mmcsd->xfer_int_stat = 0;
+    err = sdxc_send_command(base, cmd);
+    if (err != status_success)
+    {
+        return err;
+    }
+    sdxc_enable_interrupt_signal(base, SDXC_XFER_SIGNAL_MASK, true);
+
+    if (rt_sem_take(mmcsd->xfer_sem, rt_tick_from_millisecond(SDXC_XFER_TIMEOUT_MS)) != RT_EOK)
+    {
+        sdxc_enable_interrupt_signal(base, SDXC_XFER_SIGNAL_MASK, false);
+        LOG_E("cmd%d data timeout\n", cmd->cmd_index);
+        return status_timeout;
+    }
+    int_stat = mmcsd->xfer_int_stat;
+
+    /* the command completed before the data, or failed, this only picks up the response */
+    err = sdxc_wait_cmd_done(base, cmd, true);
+    if (err != status_success)
+    {
+        return err;
+    }
+    if ((int_stat & SDXC_INT_STAT_ERR_INTERRUPT_MASK) != 0U)
+    {
+        return status_sdxc_transfer_data_failed;
+    }
+    sdxc_clear_interrupt_status(base, SDXC_INT_STAT_XFER_COMPLETE_MASK | SDXC_INT_STAT_DMA_INTERRUPT_MASK);
+
+    return status_success;
+}
 
 /**
  * !@brief SDMMC request implementation based on HPMicro SDXC Host
@@ -72,8 +471,6 @@ static void hpm_sdmmc_request(struct rt_mmcsd_host *host, struct rt_mmcsd_req *r
     sdxc_adma_config_t adma_config = { 0 };
     sdxc_xfer_t xfer = { 0 };
     sdxc_command_t sdxc_cmd = { 0 };
-    sdxc_data_t sdxc_data = { 0 };
-    uint32_t *aligned_buf = NULL;
     hpm_stat_t err = status_invalid_argument;
 
     RT_ASSERT(host != RT_NULL);RT_ASSERT(host->private_data != RT_NULL);RT_ASSERT(req != RT_NULL);RT_ASSERT(req->cmd != RT_NULL);
@@ -131,124 +528,53 @@ static void hpm_sdmmc_request(struct rt_mmcsd_host *host, struct rt_mmcsd_req *r
     }
     sdxc_cmd.cmd_flags = 0UL;
     xfer.command = &sdxc_cmd;
+    cmd->err = RT_EOK;
+
     if (data != NULL)
     {
-        sdxc_data.enable_auto_cmd12 = false;
-        sdxc_data.enable_auto_cmd23 = false;
-
-        sdxc_data.enable_ignore_error = false;
-        sdxc_data.data_type = sdxc_xfer_data_normal;
-        sdxc_data.block_size = data->blksize;
-        sdxc_data.block_cnt = data->blks;
-
-        /* configure adma2 */
-        adma_config.dma_type = sdxc_dmasel_adma2;
-        adma_config.adma_table = (uint32_t*) core_local_mem_to_sys_address(BOARD_RUNNING_CORE,
-                (uint32_t) mmcsd->sdxc_adma2_table);
-        adma_config.adma_table_words = SDXC_ADMA_TABLE_WORDS;
+        mmcsd->data_reqs++;
+        cmd->err = hpm_sdmmc_map_data(mmcsd, data);
+    }
 
-        if ((req->data->flags & DATA_DIR_WRITE) != 0U)
+    if (cmd->err == RT_EOK)
+    {
+        if (data != NULL)
         {
-            uint32_t write_size = data->blks * data->blksize;
-            if (!SDXC_IS_CACHELINE_ALIGNED(data->buf) || !SDXC_IS_CACHELINE_ALIGNED(write_size))
-            {
-                write_size = SDXC_CACHELINE_ALIGN_UP(write_size);
-                aligned_buf = (uint32_t *) rt_malloc_align(write_size, CACHE_LINESIZE);
-                memcpy(aligned_buf, data->buf, write_size);
-                sdxc_data.tx_data = aligned_buf;
-                rt_enter_critical();
-                l1c_dc_flush((uint32_t) sdxc_data.tx_data, write_size);
-                rt_exit_critical();
-            }
-            else
-            {
-                sdxc_data.tx_data = (uint32_t const *) core_local_mem_to_sys_address(BOARD_RUNNING_CORE,
-                        (uint32_t) data->buf);
-                rt_enter_critical();
-                l1c_dc_flush((uint32_t) data->buf, write_size);
-                rt_exit_critical();
-            }
-            sdxc_data.rx_data = NULL;
+            err = hpm_sdmmc_transfer_data(mmcsd, &sdxc_cmd, data);
+        }
+        else
+        {
+            adma_config.dma_type = sdxc_dmasel_adma2;
+            err = sdxc_transfer_blocking(mmcsd->sdxc_base, &adma_config, &xfer);
+        }
+        LOG_I("cmd=%d, arg=%x\n", cmd->cmd_code, cmd->arg);
+        if (err != status_success)
+        {
+            hpm_sdmmc_host_recovery(mmcsd->sdxc_base);
+            LOG_E(" ***sdxc_transfer_blocking error: %d*** -->\n", err);
+            cmd->err = -RT_ERROR;
         }
         else
         {
-            uint32_t read_size = data->blks * data->blksize;
-            if (!SDXC_IS_CACHELINE_ALIGNED(data->buf) || !SDXC_IS_CACHELINE_ALIGNED(read_size))
+            LOG_I(" ***sdxc_transfer_blocking passed: %d*** -->\n", err);
+            if (sdxc_cmd.resp_type == sdxc_dev_resp_r2)
             {
-                uint32_t aligned_read_size = SDXC_CACHELINE_ALIGN_UP(read_size);
-                aligned_buf = (uint32_t *) rt_malloc_align(aligned_read_size, CACHE_LINESIZE);
-                sdxc_data.rx_data = aligned_buf;
+                LOG_I("resp:0x%08x 0x%08x 0x%08x 0x%08x\n", sdxc_cmd.response[0],
+                        sdxc_cmd.response[1], sdxc_cmd.response[2], sdxc_cmd.response[3]);
             }
             else
             {
-                sdxc_data.rx_data = (uint32_t*) core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) data->buf);
+                LOG_I("resp:0x%08x\n", sdxc_cmd.response[0]);
             }
-            sdxc_data.tx_data = NULL;
         }
-        xfer.data = &sdxc_data;
-    }
-    else
-    {
-        xfer.data = NULL;
     }
 
-    if ((req->data != NULL) && (req->data->blks > 1)) {
-        sdxc_command_t set_block_count_cmd = {0};
-        set_block_count_cmd.cmd_index = SET_BLOCK_COUNT;
-        set_block_count_cmd.resp_type = sdxc_dev_resp_r1;
-        set_block_count_cmd.cmd_flags = 0;
-        set_block_count_cmd.cmd_argument = req->data->blks;
-        sdxc_send_command(mmcsd->sdxc_base, &set_block_count_cmd);
-        sdxc_wait_cmd_done(mmcsd->sdxc_base, &set_block_count_cmd, true);
-    }
-
-    if (xfer.data != NULL)
-    {
-        // rt_kprintf("blocks=%d, block_size=%dbytes, buf_addr=%08x\n", xfer.data->block_cnt, xfer.data->block_size,
-        //         xfer.data->rx_data !=NULL ? (uint32_t)xfer.data->rx_data : (uint32_t)xfer.data->tx_data);
-    }
-    err = sdxc_transfer_blocking(mmcsd->sdxc_base, &adma_config, &xfer);
-    LOG_I("cmd=%d, arg=%x\n", cmd->cmd_code, cmd->arg);
-    if (err != status_success)
-    {
-        hpm_sdmmc_host_recovery(mmcsd->sdxc_base);
-        LOG_E(" ***sdxc_transfer_blocking error: %d*** -->\n", err);
-        cmd->err = -RT_ERROR;
-    }
-    else
-    {
-        LOG_I(" ***sdxc_transfer_blocking passed: %d*** -->\n", err);
-        if (sdxc_cmd.resp_type == sdxc_dev_resp_r2)
-        {
-            LOG_I("resp:0x%08x 0x%08x 0x%08x 0x%08x\n", sdxc_cmd.response[0],
-                    sdxc_cmd.response[1], sdxc_cmd.response[2], sdxc_cmd.response[3]);
-        }
-        else
-        {
-            LOG_I("resp:0x%08x\n", sdxc_cmd.response[0]);
-        }
-
-    }
-    if ((sdxc_data.rx_data != NULL) && (cmd->err == RT_EOK))
+    if (data != NULL)
     {
-        uint32_t read_size = data->blks * data->blksize;
-        if (aligned_buf != NULL)
-        {
-            uint32_t aligned_read_size = SDXC_CACHELINE_ALIGN_UP(read_size);
-            rt_enter_critical();
-            l1c_dc_invalidate((uint32_t) aligned_buf, aligned_read_size);
-            rt_exit_critical();
-            memcpy(data->buf, aligned_buf, read_size);
-        }
-        else
-        {
-            rt_enter_critical();
-            l1c_dc_invalidate((uint32_t) data->buf, read_size);
-            rt_exit_critical();
-        }
+        hpm_sdmmc_unmap_data(mmcsd, data, cmd->err == RT_EOK);
 
 #if defined(DBG_LEVEL) && (DBG_LEVEL >= DBG_INFO)
-        if ((cmd->cmd_code == 17) || (cmd->cmd_code == 18))
+        if ((cmd->err == RT_EOK) && ((cmd->cmd_code == 17) || (cmd->cmd_code == 18)))
         {
             uint8_t *data_8 = (uint8_t*) data->buf;
             uint32_t data_size = data->blksize * data->blks;
@@ -263,21 +589,18 @@ static void hpm_sdmmc_request(struct rt_mmcsd_host *host, struct rt_mmcsd_req *r
 #endif
     }
 
-    if (aligned_buf != NULL)
+    /* auto CMD23/CMD12 already ended a good multiple block transfer, a failed one still needs the stop */
+    if ((req->stop != RT_NULL) && (req->stop->cmd_code == STOP_TRANSMISSION)
+            && ((cmd->err != RT_EOK) || (data == NULL) || (data->blks <= 1)))
     {
-        rt_free_align(aligned_buf);
-        aligned_buf = NULL;
-    }
-
-    if ((req->stop != RT_NULL) && (req->stop->cmd_code == STOP_TRANSMISSION))
-    {
-        sdxc_cmd.cmd_index = STOP_TRANSMISSION;
-        sdxc_cmd.resp_type = sdxc_dev_resp_r1b;
-        sdxc_cmd.cmd_flags = 0;
-        sdxc_cmd.cmd_argument = req->stop->arg;
-        sdxc_send_command(mmcsd->sdxc_base, &sdxc_cmd);
-
-        sdxc_wait_cmd_done(mmcsd->sdxc_base, &sdxc_cmd, true);
+        sdxc_command_t stop_cmd = { 0 };
+        stop_cmd.cmd_index = STOP_TRANSMISSION;
+        stop_cmd.cmd_type = sdxc_cmd_type_abort_cmd;
+        stop_cmd.resp_type = sdxc_dev_resp_r1b;
+        stop_cmd.cmd_argument = req->stop->arg;
+        sdxc_send_command(mmcsd->sdxc_base, &stop_cmd);
+
+        sdxc_wait_cmd_done(mmcsd->sdxc_base, &stop_cmd, true);
     }
 
     if ((cmd->flags & RESP_MASK) == RESP_R2)
@@ -295,23 +618,41 @@ static void hpm_sdmmc_request(struct rt_mmcsd_host *host, struct rt_mmcsd_req *r
     mmcsd_req_complete(host);
 }
 
+static sdxc_speed_mode_t hpm_sdmmc_speed_mode(rt_uint8_t timing)
+{
+    switch (timing)
+    {
+    case MMCSD_TIMING_SD_HS:
+        return sdxc_sd_speed_high;
+    case MMCSD_TIMING_UHS_SDR50:
+        return sdxc_sd_speed_sdr50;
+    case MMCSD_TIMING_UHS_SDR104:
+        return sdxc_sd_speed_sdr104;
+    default:
+        return sdxc_sd_speed_normal;
+    }
+}
+
 /**
  * !@brief Set IO Configuration for HPMicro IO and SDXC Host
  */
 static void hpm_sdmmc_set_iocfg(struct rt_mmcsd_host *host, struct rt_mmcsd_io_cfg *io_cfg)
 {
     struct hpm_mmcsd *mmcsd;
-    uint32_t sdxc_clk;
-    uint32_t vdd;
     RT_ASSERT(host != RT_NULL);RT_ASSERT(host->private_data != RT_NULL);RT_ASSERT(io_cfg != RT_NULL);
 
     mmcsd = (struct hpm_mmcsd *) host->private_data;
 
-    vdd = io_cfg->vdd;
-
-    static bool has_init = false;
-
-    init_sdxc_pins(mmcsd->sdxc_base, false);
+    /* the pads stay at the level the card signals on, 3.3V until CMD11 */
+    if (io_cfg->signal_voltage == MMCSD_SIGNAL_VOLTAGE_180)
+    {
+        board_sd_switch_pins_to_1v8(mmcsd->sdxc_base);
+    }
+    else
+    {
+        sdxc_switch_to_1v8_signal(mmcsd->sdxc_base, false);
+        init_sdxc_pins(mmcsd->sdxc_base, false);
+    }
 
     uint32_t sdxc_clock = io_cfg->clock;
 
@@ -329,11 +670,108 @@ static void hpm_sdmmc_set_iocfg(struct rt_mmcsd_host *host, struct rt_mmcsd_io_c
             sdxc_set_data_bus_width(mmcsd->sdxc_base, sdxc_bus_width_1bit);
             break;
         }
-        board_sd_configure_clock(mmcsd->sdxc_base, sdxc_clk);
+        sdxc_set_speed_mode(mmcsd->sdxc_base, hpm_sdmmc_speed_mode(io_cfg->timing));
+        mmcsd->actual_clock = board_sd_configure_clock(mmcsd->sdxc_base, sdxc_clock);
     }
     rt_thread_mdelay(5);
 }
 
+/**
+ * !@brief Host half of the CMD11 sequence, the card holds DAT[3:0] low until both sides are at 1.8V
+ */
+static rt_int32_t hpm_sdmmc_switch_uhs_voltage(struct rt_mmcsd_host *host)
+{
+    struct hpm_mmcsd *mmcsd = (struct hpm_mmcsd *) host->private_data;
+    SDXC_Type *base = mmcsd->sdxc_base;
+
+    sdxc_enable_sd_clock(base, false);
+    if (sdxc_get_data3_0_level(base) != 0U)
+    {
+        LOG_E("card did not take CMD11\n");
+        sdxc_enable_sd_clock(base, true);
+        return -RT_ERROR;
+    }
+
+    board_sd_switch_pins_to_1v8(base);
+    rt_thread_mdelay(SDXC_1V8_SETTLE_MS);
+
+    sdxc_enable_sd_clock(base, true);
+    rt_thread_mdelay(1);
+    if (sdxc_get_data3_0_level(base) != 0xFU)
+    {
+        LOG_E("card did not come up at 1.8V\n");
+        sdxc_switch_to_1v8_signal(base, false);
+        init_sdxc_pins(base, false);
+        return -RT_ERROR;
+    }
+
+    return RT_EOK;
+}
+
+/**
+ * !@brief Hardware tuning with CMD19 blocks, a bounded sdxc_perform_auto_tuning()
+ */
+static rt_int32_t hpm_sdmmc_execute_tuning(struct rt_mmcsd_host *host, rt_int32_t opcode)
+{
+    struct hpm_mmcsd *mmcsd = (struct hpm_mmcsd *) host->private_data;
+    SDXC_Type *base = mmcsd->sdxc_base;
+    sdxc_command_t cmd = { 0 };
+    uint32_t loops;
+    rt_tick_t tick;
+
+    if ((host->io_cfg.timing == MMCSD_TIMING_UHS_SDR50) && !mmcsd->use_tuning_sdr50)
+    {
+        return RT_EOK;
+    }
+
+    sdxc_enable_sd_clock(base, false);
+    sdxc_enable_auto_tuning(base, true);
+    sdxc_execute_tuning(base);
+    sdxc_enable_sd_clock(base, true);
+
+    cmd.cmd_index = opcode;
+    cmd.cmd_argument = 0;
+    cmd.cmd_flags = SDXC_CMD_XFER_DATA_PRESENT_SEL_MASK | SDXC_CMD_XFER_DATA_XFER_DIR_MASK;
+    cmd.resp_type = sdxc_dev_resp_r1;
+    base->BLK_ATTR = (host->io_cfg.bus_width == MMCSD_BUS_WIDTH_8) ? 128U : 64U;
+    base->SDMASA = 0;
+
+    for (loops = 0; loops < SDXC_TUNING_MAX_LOOPS; loops++)
+    {
+        sdxc_send_command(base, &cmd);
+        tick = rt_tick_get();
+        while (!IS_HPM_BITMASK_SET(base->INT_STAT, SDXC_INT_STAT_BUF_RD_READY_MASK))
+        {
+            if (rt_tick_get() - tick > rt_tick_from_millisecond(SDXC_TUNING_BLOCK_TIMEOUT_MS))
+            {
+                break;
+            }
+        }
+        if (!IS_HPM_BITMASK_SET(base->INT_STAT, SDXC_INT_STAT_BUF_RD_READY_MASK))
+        {
+            break;
+        }
+        sdxc_clear_interrupt_status(base, SDXC_INT_STAT_BUF_RD_READY_MASK);
+        if (!IS_HPM_BITMASK_SET(base->AC_HOST_CTRL, SDXC_AC_HOST_CTRL_EXEC_TUNING_MASK))
+        {
+            break;
+        }
+    }
+
+    if (IS_HPM_BITMASK_SET(base->AC_HOST_CTRL, SDXC_AC_HOST_CTRL_EXEC_TUNING_MASK)
+            || !IS_HPM_BITMASK_SET(base->AC_HOST_CTRL, SDXC_AC_HOST_CTRL_SAMPLE_CLK_SEL_MASK))
+    {
+        LOG_E("tuning failed after %d blocks\n", loops);
+        base->AC_HOST_CTRL &= ~(SDXC_AC_HOST_CTRL_EXEC_TUNING_MASK | SDXC_AC_HOST_CTRL_SAMPLE_CLK_SEL_MASK);
+        sdxc_reset(base, sdxc_reset_cmd_line, 0xFFFFUL);
+        sdxc_reset(base, sdxc_reset_data_line, 0xFFFFUL);
+        sdxc_clear_interrupt_status(base, ~0UL);
+        return -RT_ERROR;
+    }
+
+    return RT_EOK;
+}
+
 static void hpm_sdmmc_enable_sdio_irq(struct rt_mmcsd_host *host, rt_int32_t en)
 {
     RT_ASSERT(host != RT_NULL);RT_ASSERT(host->private_data != RT_NULL);
@@ -422,6 +860,16 @@ int rt_hw_sdio_init(void)
         rt_memset(mmcsd, 0, sizeof(struct hpm_mmcsd));
         mmcsd->sdxc_base = BOARD_APP_SDCARD_SDXC_BASE;
         mmcsd->sdxc_adma2_table = s_sdxc_adma2_table;
+        mmcsd->irq_num = BOARD_APP_SDCARD_SDXC_IRQ;
+        mmcsd->xfer_sem = rt_sem_create("sdxc", 0, RT_IPC_FLAG_PRIO);
+        if (mmcsd->xfer_sem == RT_NULL)
+        {
+            LOG_E("create sdxc semaphore failed\n");
+            err = -RT_ENOMEM;
+            break;
+        }
+        s_hpm_mmcsd = mmcsd;
+        hpm_dma_pool_reserve(SDXC_BOUNCE_RESERVE_SIZE, 1);
 
         host->ops = &hpm_mmcsd_host_ops;
         host->freq_min = 375000;
@@ -429,10 +877,10 @@ int rt_hw_sdio_init(void)
         host->valid_ocr = VDD_30_31 | VDD_31_32 | VDD_32_33 | VDD_33_34;
         host->flags = MMCSD_MUTBLKWRITE | MMCSD_BUSWIDTH_4 | MMCSD_SUP_HIGHSPEED | MMCSD_SUP_SDIO_IRQ;
 
-        host->max_seg_size = 65535;
-        host->max_dma_segs = 2;
+        host->max_seg_size = SDXC_ADMA2_DESC_MAX_LEN;
+        host->max_dma_segs = SDXC_ADMA2_MAX_SEGS;
         host->max_blk_size = 512;
-        host->max_blk_count = 4096;
+        host->max_blk_count = SDXC_MAX_BLK_COUNT;
 
         mmcsd->host = host;
 
@@ -442,6 +890,33 @@ int rt_hw_sdio_init(void)
         sdxc_config_t sdxc_config = { 0 };
         sdxc_config.data_timeout = SDXC_DATA_TIMEOUT;
         sdxc_init(mmcsd->sdxc_base, &sdxc_config);
+        intc_m_enable_irq_with_priority(mmcsd->irq_num, 1);
+
+        /*
+         * The card is initialised on every boot, not only for an sd update, and this board can't
+         * cut the card power. A UHS-I card switched to 1.8V stays there until it is powered off,
+         * sdxc_reset_all at the handoff only puts the host back to 3.3V. With BSP_SDXC_USING_UHS
+         * the app must expect such a card: it no longer answers S18A in ACMD41 but still offers
+         * SDR50/SDR104 in CMD6, and the app has to move its pads to 1.8V on that (mmcsd_switch()
+         * here does). A stock driver that stays at 3.3V can't use the card until it is power cycled.
+         */
+#ifdef BSP_SDXC_USING_UHS
+        sdxc_capabilities_t caps;
+        sdxc_get_capabilities(mmcsd->sdxc_base, &caps);
+        if (caps.capabilities1.voltage_1v8_support)
+        {
+            if (caps.capabilities2.sdr50_support)
+            {
+                host->flags |= MMCSD_SUP_SDR50;
+            }
+            if (caps.capabilities2.sdr104_support)
+            {
+                host->flags |= MMCSD_SUP_SDR104;
+            }
+            mmcsd->use_tuning_sdr50 = caps.capabilities2.use_tuning_sdr50;
+            host->freq_max = SDXC_UHS_FREQ_MAX;
+        }
+#endif
 
         host->private_data = mmcsd;
 
@@ -462,4 +937,76 @@ int rt_hw_sdio_init(void)
 }
 
 INIT_DEVICE_EXPORT(rt_hw_sdio_init);
+
+static void sdio_bench(int argc, char **argv)
+{
+    const char *name = (argc > 1) ? argv[1] : "sd0";
+    rt_uint32_t total_kb = (argc > 2) ? atoi(argv[2]) : 4096;
+    rt_uint32_t chunk_kb = (argc > 3) ? atoi(argv[3]) : 64;
+    static const char *const timing_name[] = { "default", "high speed", "SDR50", "SDR104" };
+    struct rt_mmcsd_io_cfg *io_cfg;
+    rt_uint32_t reqs, ms, kbps, pos;
+    rt_tick_t tick;
+    rt_device_t dev;
+    void *buf;
+
+    if ((chunk_kb == 0) || (total_kb < chunk_kb) || (s_hpm_mmcsd == NULL))
+    {
+        rt_kprintf("usage: sdio_bench [device] [total KB] [chunk KB]\n");
+        return;
+    }
+
+    dev = rt_device_find(name);
+    if ((dev == RT_NULL) || (dev->type != RT_Device_Class_Block))
+    {
+        rt_kprintf("%s is not a block device\n", name);
+        return;
+    }
+
+    buf = rt_malloc_align(chunk_kb * 1024, CACHE_LINESIZE);
+    if (buf == RT_NULL)
+    {
+        rt_kprintf("no memory for %u KB\n", chunk_kb);
+        return;
+    }
+
+    if (rt_device_open(dev, RT_DEVICE_OFLAG_RDONLY) != RT_EOK)
+    {
+        rt_kprintf("open %s failed\n", name);
+        rt_free_align(buf);
+        return;
+    }
+
+    io_cfg = &s_hpm_mmcsd->host->io_cfg;
+    rt_kprintf("bus: %s, %d bit, %u kHz, %s signalling\n",
+            (io_cfg->timing < ARRAY_SIZE(timing_name)) ? timing_name[io_cfg->timing] : "?",
+            (io_cfg->bus_width == MMCSD_BUS_WIDTH_4) ? 4 : 1, s_hpm_mmcsd->actual_clock / 1000,
+            (io_cfg->signal_voltage == MMCSD_SIGNAL_VOLTAGE_180) ? "1.8V" : "3.3V");
+
+    reqs = s_hpm_mmcsd->data_reqs;
+    tick = rt_tick_get();
+    for (pos = 0; pos < total_kb * 2; pos += chunk_kb * 2)
+    {
+        if (rt_device_read(dev, pos, buf, chunk_kb * 2) != chunk_kb * 2)
+        {
+            rt_kprintf("read sector %u failed\n", pos);
+            break;
+        }
+    }
+    tick = rt_tick_get() - tick;
+    reqs = s_hpm_mmcsd->data_reqs - reqs;
+
+    rt_device_close(dev);
+    rt_free_align(buf);
+
+    ms = tick * 1000 / RT_TICK_PER_SECOND;
+    if (ms == 0)
+    {
+        ms = 1;
+    }
+    kbps = pos / 2 * 1000 / ms;
+    rt_kprintf("read %u KB in %u ms, %u.%02u MB/s, %u requests\n", pos / 2, ms, kbps / 1024,
+            kbps % 1024 * 100 / 1024, reqs);
+}
+MSH_CMD_EXPORT(sdio_bench, bus mode and sequential read speed of an sd block device);
 #endif
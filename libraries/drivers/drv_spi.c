@@ -12,6 +12,27 @@
 #include "drv_spi.h"
 #include "hpm_spi_drv.h"
 #include "hpm_sysctl_drv.h"
+#include "hpm_dma_drv.h"
+#include "hpm_dmamux_drv.h"
+#include "hpm_l1c_drv.h"
+#include "drv_dma_pool.h"
+#include <string.h>
+#include <stdlib.h>
+
+#if defined(BSP_SPI1_USING_DMA) || defined(BSP_SPI2_USING_DMA) || defined(BSP_SPI3_USING_DMA)
+#define SPI_USING_DMA
+#endif
+
+#ifndef BOARD_SPI_DMA
+#define BOARD_SPI_DMA       HPM_HDMA
+#define BOARD_SPI_DMAMUX    HPM_DMAMUX
+#endif
+
+/* the transfer count fields of TRANSCTRL are 9 bits wide */
+#define SPI_TRANS_COUNT_MAX (512U)
+/* shorter messages are cheaper to be polled than to set up dma */
+#define SPI_DMA_MIN_LENGTH  (32U)
+#define SPI_DMA_TIMEOUT     (1000U)
 
 struct hpm_spi
 {
@@ -21,7 +42,16 @@ struct hpm_spi
     spi_control_config_t control_config;
     struct rt_spi_bus spi_bus;
     rt_sem_t xfer_sem;
-    /* TODO: add DMA support later */
+    uint8_t data_width;
+#ifdef SPI_USING_DMA
+    rt_bool_t enable_dma;
+    uint32_t irq_num;
+    uint8_t tx_dma_channel;
+    uint8_t rx_dma_channel;
+    uint8_t tx_dma_source;
+    uint8_t rx_dma_source;
+    volatile uint32_t dma_remaining;
+#endif
 };
 
 static rt_err_t hpm_spi_configure(struct rt_spi_device *device, struct rt_spi_configuration *cfg);
@@ -39,18 +69,42 @@ static struct hpm_spi hpm_spis[] =
     {
         .bus_name = "spi1",
         .spi_base = HPM_SPI1,
+#if defined(BSP_SPI1_USING_DMA)
+        .enable_dma = RT_TRUE,
+        .irq_num = IRQn_SPI1,
+        .tx_dma_channel = BSP_SPI1_TX_DMA_CHANNEL,
+        .rx_dma_channel = BSP_SPI1_RX_DMA_CHANNEL,
+        .tx_dma_source = HPM_DMA_SRC_SPI1_TX,
+        .rx_dma_source = HPM_DMA_SRC_SPI1_RX,
+#endif
     },
 #endif
 #if defined(BSP_USING_SPI2)
     {
         .bus_name = "spi2",
         .spi_base = HPM_SPI2,
+#if defined(BSP_SPI2_USING_DMA)
+        .enable_dma = RT_TRUE,
+        .irq_num = IRQn_SPI2,
+        .tx_dma_channel = BSP_SPI2_TX_DMA_CHANNEL,
+        .rx_dma_channel = BSP_SPI2_RX_DMA_CHANNEL,
+        .tx_dma_source = HPM_DMA_SRC_SPI2_TX,
+        .rx_dma_source = HPM_DMA_SRC_SPI2_RX,
+#endif
     },
 #endif
 #if defined(BSP_USING_SPI3)
     {
         .bus_name = "spi3",
         .spi_base = HPM_SPI3,
+#if defined(BSP_SPI3_USING_DMA)
+        .enable_dma = RT_TRUE,
+        .irq_num = IRQn_SPI3,
+        .tx_dma_channel = BSP_SPI3_TX_DMA_CHANNEL,
+        .rx_dma_channel = BSP_SPI3_RX_DMA_CHANNEL,
+        .tx_dma_source = HPM_DMA_SRC_SPI3_TX,
+        .rx_dma_source = HPM_DMA_SRC_SPI3_RX,
+#endif
     },
 #endif
 };
@@ -83,6 +137,7 @@ static rt_err_t hpm_spi_configure(struct rt_spi_device *device, struct rt_spi_co
 
     timing_config.master_config.clk_src_freq_in_hz = board_init_spi_clock(spi->spi_base);
 
+    spi->data_width = cfg->data_width;
     format_config.common_config.data_len_in_bits = cfg->data_width;
     format_config.common_config.cpha = cfg->mode & RT_SPI_CPHA ? 1 : 0;
     format_config.common_config.cpol = cfg->mode & RT_SPI_CPOL ? 1 : 0;
@@ -108,32 +163,16 @@ static rt_err_t hpm_spi_configure(struct rt_spi_device *device, struct rt_spi_co
     return RT_EOK;
 }
 
-static rt_uint32_t hpm_spi_xfer(struct rt_spi_device *device, struct rt_spi_message *msg)
+static hpm_stat_t hpm_spi_xfer_polling(struct hpm_spi *spi, uint8_t *tx_buf, uint8_t *rx_buf, uint32_t length)
 {
-    RT_ASSERT(device != RT_NULL);
-    RT_ASSERT(msg != RT_NULL);
-    RT_ASSERT(device->bus != RT_NULL);
-    RT_ASSERT(device->bus->parent.user_data != RT_NULL);
-
-    cs_ctrl_callback_t cs_pin_control = (cs_ctrl_callback_t) device->parent.user_data;
-
-    struct hpm_spi *spi = (struct hpm_spi *) (device->bus->parent.user_data);
-
     hpm_stat_t spi_stat = status_success;
-
-    if ((cs_pin_control != NULL) && msg->cs_take)
-    {
-        cs_pin_control(SPI_CS_TAKE);
-    }
-
-    uint32_t remaining_size = msg->length;
+    uint32_t remaining_size = length;
     uint32_t transfer_len;
-    uint8_t *tx_buf = (uint8_t*) msg->send_buf;
-    uint8_t *rx_buf = (uint8_t*) msg->recv_buf;
+
     while (remaining_size > 0)
     {
-        transfer_len = MIN(512, remaining_size);
-        if (msg->send_buf != NULL && msg->recv_buf != NULL)
+        transfer_len = MIN(SPI_TRANS_COUNT_MAX, remaining_size);
+        if (tx_buf != NULL && rx_buf != NULL)
         {
             spi->control_config.common_config.trans_mode = spi_trans_write_read_together;
             spi_stat = spi_transfer(spi->spi_base,
@@ -143,7 +182,7 @@ static rt_uint32_t hpm_spi_xfer(struct rt_spi_device *device, struct rt_spi_mess
                                     tx_buf, transfer_len,
                                     rx_buf, transfer_len);
         }
-        else if (msg->send_buf != NULL)
+        else if (tx_buf != NULL)
         {
             spi->control_config.common_config.trans_mode = spi_trans_write_only;
             spi_stat = spi_transfer(spi->spi_base, &spi->control_config,
@@ -177,6 +216,259 @@ static rt_uint32_t hpm_spi_xfer(struct rt_spi_device *device, struct rt_spi_mess
         }
         remaining_size -= transfer_len;
     }
+
+    return spi_stat;
+}
+
+#ifdef SPI_USING_DMA
+/* start the next transaction of at most SPI_TRANS_COUNT_MAX frames, the dma channels keep running */
+static void hpm_spi_dma_next(struct hpm_spi *spi)
+{
+    SPI_Type *base = spi->spi_base;
+    uint32_t transfer_len = MIN(SPI_TRANS_COUNT_MAX, spi->dma_remaining);
+
+    spi->dma_remaining -= transfer_len;
+    base->TRANSCTRL = (base->TRANSCTRL & ~(SPI_TRANSCTRL_WRTRANCNT_MASK | SPI_TRANSCTRL_RDTRANCNT_MASK))
+                      | SPI_TRANSCTRL_WRTRANCNT_SET(transfer_len - 1)
+                      | SPI_TRANSCTRL_RDTRANCNT_SET(transfer_len - 1);
+    /* without command phase, writing CMD starts the transaction */
+    base->CMD = SPI_CMD_CMD_SET(0xff);
+}
+
+static void hpm_spi_isr(struct hpm_spi *spi)
+{
+    uint32_t stat = spi->spi_base->INTRST;
+
+    spi->spi_base->INTRST = stat;
+    if (stat & SPI_INTRST_ENDINT_MASK)
+    {
+        if (spi->dma_remaining > 0)
+        {
+            hpm_spi_dma_next(spi);
+        }
+        else
+        {
+            rt_sem_release(spi->xfer_sem);
+        }
+    }
+}
+
+static void hpm_spi_isr_by_base(SPI_Type *base)
+{
+    for (uint32_t i = 0; i < sizeof(hpm_spis) / sizeof(hpm_spis[0]); i++)
+    {
+        if (hpm_spis[i].spi_base == base)
+        {
+            hpm_spi_isr(&hpm_spis[i]);
+            break;
+        }
+    }
+}
+
+#if defined(BSP_SPI1_USING_DMA)
+void spi1_isr(void)
+{
+    hpm_spi_isr_by_base(HPM_SPI1);
+}
+SDK_DECLARE_EXT_ISR_M(IRQn_SPI1, spi1_isr)
+#endif
+
+#if defined(BSP_SPI2_USING_DMA)
+void spi2_isr(void)
+{
+    hpm_spi_isr_by_base(HPM_SPI2);
+}
+SDK_DECLARE_EXT_ISR_M(IRQn_SPI2, spi2_isr)
+#endif
+
+#if defined(BSP_SPI3_USING_DMA)
+void spi3_isr(void)
+{
+    hpm_spi_isr_by_base(HPM_SPI3);
+}
+SDK_DECLARE_EXT_ISR_M(IRQn_SPI3, spi3_isr)
+#endif
+
+/**
+ * Full-duplex transfer by dma. One dma channel per direction covers the whole message,
+ * the SPI end interrupt restarts the controller every SPI_TRANS_COUNT_MAX frames and
+ * releases xfer_sem after the last one.
+ */
+static hpm_stat_t hpm_spi_xfer_dma(struct hpm_spi *spi, uint8_t *tx_buf, uint8_t *rx_buf, uint32_t length)
+{
+    SPI_Type *base = spi->spi_base;
+    dma_handshake_config_t config;
+    hpm_stat_t stat = status_success;
+    uint8_t *rx_dma_buf = rx_buf;
+    uint8_t *aligned_buf = RT_NULL;
+    uint8_t trans_mode;
+
+    if (tx_buf != RT_NULL && rx_buf != RT_NULL)
+    {
+        trans_mode = spi_trans_write_read_together;
+    }
+    else if (tx_buf != RT_NULL)
+    {
+        trans_mode = spi_trans_write_only;
+    }
+    else
+    {
+        trans_mode = spi_trans_read_only;
+    }
+
+    if (tx_buf != RT_NULL)
+    {
+        /* write back only, so the range may be rounded to cache lines */
+        uint32_t start = HPM_L1C_CACHELINE_ALIGN_DOWN(tx_buf);
+        uint32_t end = HPM_L1C_CACHELINE_ALIGN_UP((uint32_t) tx_buf + length);
+        rt_enter_critical();
+        l1c_dc_writeback(start, end - start);
+        rt_exit_critical();
+    }
+
+    if (rx_buf != RT_NULL)
+    {
+        uint32_t aligned_size = HPM_L1C_CACHELINE_ALIGN_UP(length);
+        if (HPM_L1C_CACHELINE_ALIGN_DOWN(rx_buf) != (uint32_t) rx_buf || aligned_size != length)
+        {
+            /* invalidating a partial line would drop the neighbour data, receive to a noncacheable bounce buffer */
+            aligned_buf = (uint8_t *) hpm_dma_pool_alloc(length);
+            if (aligned_buf == RT_NULL)
+            {
+                return hpm_spi_xfer_polling(spi, tx_buf, rx_buf, length);
+            }
+            rx_dma_buf = aligned_buf;
+        }
+        else
+        {
+            rt_enter_critical();
+            l1c_dc_invalidate((uint32_t) rx_dma_buf, aligned_size);
+            rt_exit_critical();
+        }
+    }
+
+    base->TRANSCTRL = SPI_TRANSCTRL_TRANSMODE_SET(trans_mode)
+                      | SPI_TRANSCTRL_DUALQUAD_SET(spi->control_config.common_config.data_phase_fmt);
+    base->CTRL |= SPI_CTRL_TXFIFORST_MASK | SPI_CTRL_RXFIFORST_MASK | SPI_CTRL_SPIRST_MASK;
+    while (base->CTRL & (SPI_CTRL_TXFIFORST_MASK | SPI_CTRL_RXFIFORST_MASK | SPI_CTRL_SPIRST_MASK))
+    {
+    }
+
+    if (rx_buf != RT_NULL)
+    {
+        config.ch_index = spi->rx_dma_channel;
+        config.src = (uint32_t) &base->DATA;
+        config.src_fixed = true;
+        config.dst = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) rx_dma_buf);
+        config.dst_fixed = false;
+        config.size_in_byte = length;
+        dmamux_config(BOARD_SPI_DMAMUX, spi->rx_dma_channel, spi->rx_dma_source, true);
+        dma_setup_handshake(BOARD_SPI_DMA, &config);
+        base->CTRL |= SPI_CTRL_RXDMAEN_MASK;
+    }
+    if (tx_buf != RT_NULL)
+    {
+        config.ch_index = spi->tx_dma_channel;
+        config.src = core_local_mem_to_sys_address(BOARD_RUNNING_CORE, (uint32_t) tx_buf);
+        config.src_fixed = false;
+        config.dst = (uint32_t) &base->DATA;
+        config.dst_fixed = true;
+        config.size_in_byte = length;
+        dmamux_config(BOARD_SPI_DMAMUX, spi->tx_dma_channel, spi->tx_dma_source, true);
+        dma_setup_handshake(BOARD_SPI_DMA, &config);
+        base->CTRL |= SPI_CTRL_TXDMAEN_MASK;
+    }
+
+    rt_sem_control(spi->xfer_sem, RT_IPC_CMD_RESET, RT_NULL);
+    base->INTRST = SPI_INTRST_ENDINT_MASK;
+    base->INTREN |= SPI_INTREN_ENDINTEN_MASK;
+
+    spi->dma_remaining = length;
+    hpm_spi_dma_next(spi);
+
+    if (rt_sem_take(spi->xfer_sem, rt_tick_from_millisecond(SPI_DMA_TIMEOUT)) != RT_EOK)
+    {
+        stat = status_timeout;
+    }
+
+    /* the rx channel drains the last frames from the fifo shortly after the SPI end */
+    rt_tick_t start = rt_tick_get();
+    while ((stat == status_success) && (rx_buf != RT_NULL))
+    {
+        uint32_t dma_stat = dma_check_transfer_status(BOARD_SPI_DMA, spi->rx_dma_channel);
+        if (dma_stat & DMA_CHANNEL_STATUS_TC)
+        {
+            break;
+        }
+        if (dma_stat & (DMA_CHANNEL_STATUS_ERROR | DMA_CHANNEL_STATUS_ABORT))
+        {
+            stat = status_fail;
+        }
+        else if (rt_tick_get() - start > rt_tick_from_millisecond(SPI_DMA_TIMEOUT))
+        {
+            stat = status_timeout;
+        }
+    }
+
+    base->INTREN &= ~SPI_INTREN_ENDINTEN_MASK;
+    base->CTRL &= ~(SPI_CTRL_TXDMAEN_MASK | SPI_CTRL_RXDMAEN_MASK);
+    if (stat != status_success)
+    {
+        dma_abort_channel(BOARD_SPI_DMA, (1UL << spi->tx_dma_channel) | (1UL << spi->rx_dma_channel));
+        /* drop what the aborted channels left behind, the next transfer starts from empty fifos */
+        base->CTRL |= SPI_CTRL_TXFIFORST_MASK | SPI_CTRL_RXFIFORST_MASK;
+        while (base->CTRL & (SPI_CTRL_TXFIFORST_MASK | SPI_CTRL_RXFIFORST_MASK))
+        {
+        }
+    }
+
+    if (aligned_buf != RT_NULL)
+    {
+        memcpy(rx_buf, aligned_buf, length);
+        hpm_dma_pool_free(aligned_buf, length);
+    }
+    else if (rx_buf != RT_NULL)
+    {
+        rt_enter_critical();
+        l1c_dc_invalidate((uint32_t) rx_dma_buf, HPM_L1C_CACHELINE_ALIGN_UP(length));
+        rt_exit_critical();
+    }
+
+    return stat;
+}
+#endif /* SPI_USING_DMA */
+
+static rt_uint32_t hpm_spi_xfer(struct rt_spi_device *device, struct rt_spi_message *msg)
+{
+    RT_ASSERT(device != RT_NULL);
+    RT_ASSERT(msg != RT_NULL);
+    RT_ASSERT(device->bus != RT_NULL);
+    RT_ASSERT(device->bus->parent.user_data != RT_NULL);
+
+    cs_ctrl_callback_t cs_pin_control = (cs_ctrl_callback_t) device->parent.user_data;
+
+    struct hpm_spi *spi = (struct hpm_spi *) (device->bus->parent.user_data);
+
+    hpm_stat_t spi_stat = status_success;
+
+    if ((cs_pin_control != NULL) && msg->cs_take)
+    {
+        cs_pin_control(SPI_CS_TAKE);
+    }
+
+    if (msg->length > 0)
+    {
+#ifdef SPI_USING_DMA
+        if (spi->enable_dma && (spi->data_width == 8) && (msg->length >= SPI_DMA_MIN_LENGTH))
+        {
+            spi_stat = hpm_spi_xfer_dma(spi, (uint8_t*) msg->send_buf, (uint8_t*) msg->recv_buf, msg->length);
+        }
+        else
+#endif
+        {
+            spi_stat = hpm_spi_xfer_polling(spi, (uint8_t*) msg->send_buf, (uint8_t*) msg->recv_buf, msg->length);
+        }
+    }
     if (spi_stat != status_success)
     {
         msg->length = 0;
@@ -228,6 +520,12 @@ int rt_hw_spi_init(void)
         char sem_name[RT_NAME_MAX];
         rt_sprintf(sem_name, "%s_s", hpm_spis[i].bus_name);
         hpm_spis[i].xfer_sem = rt_sem_create(sem_name, 0, RT_IPC_FLAG_PRIO);
+#ifdef SPI_USING_DMA
+        if (hpm_spis[i].enable_dma)
+        {
+            intc_m_enable_irq_with_priority(hpm_spis[i].irq_num, 1);
+        }
+#endif
     }
 
     return ret;
@@ -235,5 +533,141 @@ int rt_hw_spi_init(void)
 
 INIT_BOARD_EXPORT(rt_hw_spi_init);
 
+#if defined(RT_USING_FINSH) && defined(SPI_USING_DMA)
+static volatile uint32_t spi_bench_idle_count;
+static volatile rt_bool_t spi_bench_idle_run;
+
+static void spi_bench_idle_entry(void *parameter)
+{
+    while (spi_bench_idle_run)
+    {
+        spi_bench_idle_count++;
+    }
+}
+
+/* throughput of the polled and the dma path, the idle counter tells how much cpu was left */
+static int spi_bench(int argc, char **argv)
+{
+    struct rt_spi_device *device;
+    struct rt_spi_configuration cfg;
+    struct hpm_spi *spi;
+    rt_thread_t idle_thread;
+    uint8_t *tx_buf, *rx_buf;
+    uint32_t length = 1536, count = 1000, hz = 20 * 1000 * 1000;
+    uint32_t calib_count, calib_tick;
+    rt_bool_t enable_dma;
+    char dev_name[RT_NAME_MAX];
+
+    if (argc < 2)
+    {
+        rt_kprintf("Usage: spi_bench <bus> [length] [count] [hz]\n");
+        return -RT_ERROR;
+    }
+    if (argc > 2) length = atoi(argv[2]);
+    if (argc > 3) count = atoi(argv[3]);
+    if (argc > 4) hz = atoi(argv[4]);
+    if (length == 0 || count == 0)
+    {
+        return -RT_ERROR;
+    }
+
+    rt_snprintf(dev_name, sizeof(dev_name), "%sb", argv[1]);
+    device = (struct rt_spi_device *) rt_device_find(dev_name);
+    if (device == RT_NULL)
+    {
+        if (rt_hw_spi_device_attach(argv[1], dev_name, RT_NULL) != RT_EOK)
+        {
+            return -RT_ERROR;
+        }
+        device = (struct rt_spi_device *) rt_device_find(dev_name);
+    }
+    spi = (struct hpm_spi *) device->bus->parent.user_data;
+
+    cfg.data_width = 8;
+    cfg.mode = RT_SPI_MASTER | RT_SPI_MODE_0 | RT_SPI_MSB;
+    cfg.max_hz = hz;
+    rt_spi_configure(device, &cfg);
+
+    tx_buf = rt_malloc_align(length, HPM_L1C_CACHELINE_SIZE);
+    rx_buf = rt_malloc_align(length, HPM_L1C_CACHELINE_SIZE);
+    if (tx_buf == RT_NULL || rx_buf == RT_NULL)
+    {
+        rt_kprintf("no memory\n");
+        goto _exit;
+    }
+    for (uint32_t i = 0; i < length; i++)
+    {
+        tx_buf[i] = (uint8_t) (i * 7 + 1);
+    }
+
+    spi_bench_idle_run = RT_TRUE;
+    spi_bench_idle_count = 0;
+    idle_thread = rt_thread_create("spi_idle", spi_bench_idle_entry, RT_NULL, 512, RT_THREAD_PRIORITY_MAX - 2, 10);
+    if (idle_thread == RT_NULL)
+    {
+        goto _exit;
+    }
+    rt_thread_startup(idle_thread);
+
+    /* the whole cpu goes to the idle counter while this thread sleeps */
+    calib_tick = rt_tick_get();
+    rt_thread_mdelay(500);
+    calib_count = spi_bench_idle_count;
+    calib_tick = rt_tick_get() - calib_tick;
+
+    enable_dma = spi->enable_dma;
+    for (int pass = 0; pass < 2; pass++)
+    {
+        rt_tick_t tick;
+        uint32_t idle, errors = 0;
+
+        spi->enable_dma = (pass == 1) ? enable_dma : RT_FALSE;
+        if (pass == 1 && !enable_dma)
+        {
+            break;
+        }
+
+        spi_bench_idle_count = 0;
+        tick = rt_tick_get();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            rt_memset(rx_buf, 0, length);
+            if (rt_spi_transfer(device, tx_buf, rx_buf, length) != length)
+            {
+                errors++;
+            }
+        }
+        tick = rt_tick_get() - tick;
+        idle = spi_bench_idle_count;
+        if (tick == 0)
+        {
+            tick = 1;
+        }
+
+        /* rates in KB/s and cpu load in 0.1 % to stay away from float printing */
+        uint32_t kbps = (uint32_t) ((uint64_t) length * count * RT_TICK_PER_SECOND / tick / 1024);
+        uint32_t load = 1000 - (uint32_t) ((uint64_t) idle * calib_tick * 1000 / ((uint64_t) calib_count * tick + 1));
+        if (load > 1000)
+        {
+            load = 0;
+        }
+        rt_kprintf("%-7s %u x %u bytes: %u.%03u MB/s, cpu %u.%u%%, errors %u, loopback %s\n",
+                   pass ? "dma" : "polling", count, length,
+                   kbps / 1024, (kbps % 1024) * 1000 / 1024, load / 10, load % 10, errors,
+                   memcmp(tx_buf, rx_buf, length) == 0 ? "match" : "mismatch");
+    }
+    spi->enable_dma = enable_dma;
+
+    spi_bench_idle_run = RT_FALSE;
+    rt_thread_mdelay(20);
+
+_exit:
+    if (tx_buf) rt_free_align(tx_buf);
+    if (rx_buf) rt_free_align(rx_buf);
+    return RT_EOK;
+}
+MSH_CMD_EXPORT(spi_bench, spi throughput polling vs dma: spi_bench <bus> [length] [count] [hz]);
+#endif /* RT_USING_FINSH && SPI_USING_DMA */
+
 #endif /*BSP_USING_SPI*/
 
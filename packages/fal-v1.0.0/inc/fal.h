@@ -127,6 +127,15 @@ void fal_show_part_table(void);
  */
 struct rt_device *fal_blk_device_create(const char *parition_name);
 
+/**
+ * write the cached sectors of all block devices back to the flash,
+ * before the partitions are used without the block device
+ *
+ * @return RT_EOK: all written back
+ *        -RT_ERROR: a sector could not be written
+ */
+int fal_blk_device_sync(void);
+
 #if defined(RT_USING_MTD_NOR)
 /**
  * create RT-Thread MTD NOR device by specified partition
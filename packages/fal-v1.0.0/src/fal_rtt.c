@@ -17,13 +17,225 @@
 #include <string.h>
 
 /* ========================== block device ======================== */
+/*
+ * Block writes are kept in a write-back cache of whole erase sectors, so the small
+ * sector updates of a file system are merged in RAM and a sector costs one erase and
+ * one program when it is evicted or synced. Set FAL_BLK_CACHE_NUM to 0 in fal_cfg.h
+ * to write through as before.
+ */
+#ifndef FAL_BLK_CACHE_NUM
+#define FAL_BLK_CACHE_NUM              2
+#endif
+
+/* block size of a cached device, the erase size is used if it does not divide that */
+#ifndef FAL_BLK_SECTOR_SIZE
+#define FAL_BLK_SECTOR_SIZE            512
+#endif
+
+#define FAL_BLK_CACHE_EMPTY            ((rt_uint32_t) -1)
+
+#if FAL_BLK_CACHE_NUM > 0
+struct fal_blk_cache
+{
+    rt_uint32_t                     addr;       /* partition offset of the erase sector */
+    rt_uint32_t                     used;       /* last use, the oldest one is evicted */
+    rt_bool_t                       dirty;
+    rt_uint8_t                     *buf;
+};
+#endif
+
 struct fal_blk_device
 {
     struct rt_device                parent;
     struct rt_device_blk_geometry   geometry;
     const struct fal_partition     *fal_part;
+#if FAL_BLK_CACHE_NUM > 0
+    rt_uint32_t                     erase_size;
+    rt_uint32_t                     use_count;
+    struct rt_mutex                 lock;
+    struct fal_blk_cache            cache[FAL_BLK_CACHE_NUM];
+    struct fal_blk_device          *next;       /* all cached devices, see fal_blk_device_sync() */
+#endif
 };
 
+#if FAL_BLK_CACHE_NUM > 0
+static struct fal_blk_device *blk_dev_list = RT_NULL;
+#endif
+
+#if FAL_BLK_CACHE_NUM > 0
+/* program a dirty sector back, it is only erased when a bit has to go from 0 to 1 */
+static int blk_cache_flush(struct fal_blk_device *part, struct fal_blk_cache *cache)
+{
+    rt_uint8_t flash[64];
+    rt_uint32_t i, j, n, first = part->erase_size, last = 0;
+    rt_bool_t need_erase = RT_FALSE;
+
+    if (!cache->dirty)
+    {
+        return RT_EOK;
+    }
+
+    for (i = 0; i < part->erase_size; i += n)
+    {
+        n = part->erase_size - i < sizeof(flash) ? part->erase_size - i : sizeof(flash);
+        if (fal_partition_read(part->fal_part, cache->addr + i, flash, n) != (int) n)
+        {
+            return -RT_ERROR;
+        }
+
+        for (j = 0; j < n; j++)
+        {
+            if (flash[j] == cache->buf[i + j])
+            {
+                continue;
+            }
+            if ((flash[j] & cache->buf[i + j]) != cache->buf[i + j])
+            {
+                need_erase = RT_TRUE;
+            }
+            if (first > i + j)
+            {
+                first = i + j;
+            }
+            last = i + j;
+        }
+    }
+
+    if (need_erase)
+    {
+        if (fal_partition_erase(part->fal_part, cache->addr, part->erase_size) < 0)
+        {
+            return -RT_ERROR;
+        }
+
+        /* blank bytes at both ends need no programming */
+        for (first = 0; (first < part->erase_size) && (cache->buf[first] == 0xFF); first++);
+        for (last = part->erase_size - 1; (last > first) && (cache->buf[last] == 0xFF); last--);
+    }
+
+    if ((first < part->erase_size)
+            && (fal_partition_write(part->fal_part, cache->addr + first, cache->buf + first, last - first + 1) < 0))
+    {
+        return -RT_ERROR;
+    }
+
+    cache->dirty = RT_FALSE;
+
+    return RT_EOK;
+}
+
+static struct fal_blk_cache *blk_cache_find(struct fal_blk_device *part, rt_uint32_t addr)
+{
+    rt_uint32_t i;
+
+    for (i = 0; i < FAL_BLK_CACHE_NUM; i++)
+    {
+        if (part->cache[i].addr == addr)
+        {
+            part->cache[i].used = ++part->use_count;
+            return &part->cache[i];
+        }
+    }
+
+    return RT_NULL;
+}
+
+/* cache the erase sector at addr, it is not read from the flash if the caller overwrites all of it */
+static struct fal_blk_cache *blk_cache_get(struct fal_blk_device *part, rt_uint32_t addr, rt_bool_t load)
+{
+    struct fal_blk_cache *cache = blk_cache_find(part, addr);
+    rt_uint32_t i;
+
+    if (cache != RT_NULL)
+    {
+        return cache;
+    }
+
+    cache = &part->cache[0];
+    for (i = 1; (i < FAL_BLK_CACHE_NUM) && (cache->addr != FAL_BLK_CACHE_EMPTY); i++)
+    {
+        if ((part->cache[i].addr == FAL_BLK_CACHE_EMPTY) || (part->cache[i].used < cache->used))
+        {
+            cache = &part->cache[i];
+        }
+    }
+
+    if (blk_cache_flush(part, cache) != RT_EOK)
+    {
+        log_e("Error: flush the sector at 0x%08x of %s failed.", cache->addr, part->fal_part->name);
+        return RT_NULL;
+    }
+
+    cache->addr = FAL_BLK_CACHE_EMPTY;
+    if (load && (fal_partition_read(part->fal_part, addr, cache->buf, part->erase_size) != (int) part->erase_size))
+    {
+        return RT_NULL;
+    }
+    cache->addr = addr;
+    cache->used = ++part->use_count;
+
+    return cache;
+}
+
+static rt_err_t blk_cache_sync(struct fal_blk_device *part)
+{
+    rt_err_t result = RT_EOK;
+    rt_uint32_t i;
+
+    for (i = 0; i < FAL_BLK_CACHE_NUM; i++)
+    {
+        if (blk_cache_flush(part, &part->cache[i]) != RT_EOK)
+        {
+            log_e("Error: flush the sector at 0x%08x of %s failed.", part->cache[i].addr, part->fal_part->name);
+            result = -RT_ERROR;
+        }
+    }
+
+    return result;
+}
+
+/* whole erase sectors are erased right away, parts of one are blanked in the cache */
+static rt_err_t blk_cache_erase(struct fal_blk_device *part, rt_uint32_t start, rt_uint32_t end)
+{
+    rt_uint32_t block_size = part->geometry.block_size, addr, sector;
+    struct fal_blk_cache *cache;
+
+    while (start < end)
+    {
+        addr = start * block_size;
+        sector = addr - addr % part->erase_size;
+
+        if ((addr == sector) && ((end - start) * block_size >= part->erase_size))
+        {
+            cache = blk_cache_find(part, sector);
+            if (cache != RT_NULL)
+            {
+                cache->addr = FAL_BLK_CACHE_EMPTY;
+                cache->dirty = RT_FALSE;
+            }
+            if (fal_partition_erase(part->fal_part, sector, part->erase_size) < 0)
+            {
+                return -RT_ERROR;
+            }
+            start += part->erase_size / block_size;
+        }
+        else
+        {
+            cache = blk_cache_get(part, sector, RT_TRUE);
+            if (cache == RT_NULL)
+            {
+                return -RT_ERROR;
+            }
+            memset(cache->buf + addr - sector, 0xFF, block_size);
+            cache->dirty = RT_TRUE;
+            start++;
+        }
+    }
+
+    return RT_EOK;
+}
+#endif /* FAL_BLK_CACHE_NUM > 0 */
+
 /* RT-Thread device interface */
 #if RTTHREAD_VERSION >= 30000
 static rt_err_t blk_dev_control(rt_device_t dev, int cmd, void *args)
@@ -47,6 +259,18 @@ static rt_err_t blk_dev_control(rt_device_t dev, rt_uint8_t cmd, void *args)
 
         memcpy(geometry, &part->geometry, sizeof(struct rt_device_blk_geometry));
     }
+#if FAL_BLK_CACHE_NUM > 0
+    else if (cmd == RT_DEVICE_CTRL_BLK_SYNC)
+    {
+        rt_err_t result;
+
+        rt_mutex_take(&part->lock, RT_WAITING_FOREVER);
+        result = blk_cache_sync(part);
+        rt_mutex_release(&part->lock);
+
+        return result;
+    }
+#endif
     else if (cmd == RT_DEVICE_CTRL_BLK_ERASE)
     {
         rt_uint32_t *addrs = (rt_uint32_t *) args, start_addr = addrs[0], end_addr = addrs[1], phy_start_addr;
@@ -62,6 +286,18 @@ static rt_err_t blk_dev_control(rt_device_t dev, rt_uint8_t cmd, void *args)
             end_addr++;
         }
 
+#if FAL_BLK_CACHE_NUM > 0
+        {
+            rt_err_t result;
+
+            rt_mutex_take(&part->lock, RT_WAITING_FOREVER);
+            result = blk_cache_erase(part, start_addr, end_addr);
+            rt_mutex_release(&part->lock);
+
+            return result;
+        }
+#endif
+
         phy_start_addr = start_addr * part->geometry.bytes_per_sector;
         phy_size = (end_addr - start_addr) * part->geometry.bytes_per_sector;
 
@@ -74,6 +310,16 @@ static rt_err_t blk_dev_control(rt_device_t dev, rt_uint8_t cmd, void *args)
     return RT_EOK;
 }
 
+/* dfs_unmount() closes the device, nothing is left in the cache after that */
+static rt_err_t blk_dev_close(rt_device_t dev)
+{
+#if FAL_BLK_CACHE_NUM > 0
+    return blk_dev_control(dev, RT_DEVICE_CTRL_BLK_SYNC, RT_NULL);
+#else
+    return RT_EOK;
+#endif
+}
+
 static rt_size_t blk_dev_read(rt_device_t dev, rt_off_t pos, void* buffer, rt_size_t size)
 {
     int ret = 0;
@@ -81,6 +327,41 @@ static rt_size_t blk_dev_read(rt_device_t dev, rt_off_t pos, void* buffer, rt_si
 
     assert(part != RT_NULL);
 
+#if FAL_BLK_CACHE_NUM > 0
+    {
+        rt_uint32_t block_size = part->geometry.block_size, addr, i, n;
+        struct fal_blk_cache *cache;
+
+        rt_mutex_take(&part->lock, RT_WAITING_FOREVER);
+        for (i = 0; i < size; i += n)
+        {
+            addr = (pos + i) * block_size;
+            cache = blk_cache_find(part, addr - addr % part->erase_size);
+            if (cache != RT_NULL)
+            {
+                memcpy((rt_uint8_t *) buffer + i * block_size, cache->buf + addr % part->erase_size, block_size);
+                n = 1;
+                continue;
+            }
+
+            /* read the rest of this erase sector from the flash in one go */
+            n = (part->erase_size - addr % part->erase_size) / block_size;
+            if (n > size - i)
+            {
+                n = size - i;
+            }
+            if (fal_partition_read(part->fal_part, addr, (rt_uint8_t *) buffer + i * block_size, n * block_size)
+                    != (int) (n * block_size))
+            {
+                break;
+            }
+        }
+        rt_mutex_release(&part->lock);
+
+        return i < size ? 0 : size;
+    }
+#endif
+
     ret = fal_partition_read(part->fal_part, pos * part->geometry.block_size, buffer, size * part->geometry.block_size);
 
     if (ret != (int)(size * part->geometry.block_size))
@@ -105,6 +386,30 @@ static rt_size_t blk_dev_write(rt_device_t dev, rt_off_t pos, const void* buffer
     part = (struct fal_blk_device*) dev;
     assert(part != RT_NULL);
 
+#if FAL_BLK_CACHE_NUM > 0
+    {
+        rt_uint32_t block_size = part->geometry.block_size, addr, sector, i;
+        struct fal_blk_cache *cache;
+
+        rt_mutex_take(&part->lock, RT_WAITING_FOREVER);
+        for (i = 0; i < size; i++)
+        {
+            addr = (pos + i) * block_size;
+            sector = addr - addr % part->erase_size;
+            cache = blk_cache_get(part, sector, block_size < part->erase_size);
+            if (cache == RT_NULL)
+            {
+                break;
+            }
+            memcpy(cache->buf + addr - sector, (const rt_uint8_t *) buffer + i * block_size, block_size);
+            cache->dirty = RT_TRUE;
+        }
+        rt_mutex_release(&part->lock);
+
+        return i < size ? 0 : size;
+    }
+#endif
+
     /* change the block device's logic address to physical address */
     phy_pos = pos * part->geometry.bytes_per_sector;
     phy_size = size * part->geometry.bytes_per_sector;
@@ -133,7 +438,7 @@ const static struct rt_device_ops blk_dev_ops =
 {
     RT_NULL,
     RT_NULL,
-    RT_NULL,
+    blk_dev_close,
     blk_dev_read,
     blk_dev_write,
     blk_dev_control
@@ -174,6 +479,45 @@ struct rt_device *fal_blk_device_create(const char *parition_name)
         blk_dev->geometry.block_size = fal_flash->blk_size;
         blk_dev->geometry.sector_count = fal_part->len / fal_flash->blk_size;
 
+#if FAL_BLK_CACHE_NUM > 0
+        {
+            rt_uint32_t i;
+
+            if (fal_flash->blk_size % FAL_BLK_SECTOR_SIZE == 0)
+            {
+                blk_dev->geometry.bytes_per_sector = FAL_BLK_SECTOR_SIZE;
+                blk_dev->geometry.block_size = FAL_BLK_SECTOR_SIZE;
+                blk_dev->geometry.sector_count = fal_part->len / FAL_BLK_SECTOR_SIZE;
+            }
+
+            blk_dev->erase_size = fal_flash->blk_size;
+            blk_dev->use_count = 0;
+            for (i = 0; i < FAL_BLK_CACHE_NUM; i++)
+            {
+                blk_dev->cache[i].addr = FAL_BLK_CACHE_EMPTY;
+                blk_dev->cache[i].used = 0;
+                blk_dev->cache[i].dirty = RT_FALSE;
+                blk_dev->cache[i].buf = (rt_uint8_t *) rt_malloc(blk_dev->erase_size);
+                if (blk_dev->cache[i].buf == RT_NULL)
+                {
+                    log_e("Error: no memory for the FAL block device cache");
+                    while (i-- > 0)
+                    {
+                        rt_free(blk_dev->cache[i].buf);
+                    }
+                    rt_free(blk_dev);
+                    return NULL;
+                }
+            }
+            rt_mutex_init(&blk_dev->lock, fal_part->name, RT_IPC_FLAG_PRIO);
+
+            rt_enter_critical();
+            blk_dev->next = blk_dev_list;
+            blk_dev_list = blk_dev;
+            rt_exit_critical();
+        }
+#endif
+
         /* register device */
         blk_dev->parent.type = RT_Device_Class_Block;
 
@@ -182,7 +526,7 @@ struct rt_device *fal_blk_device_create(const char *parition_name)
 #else
         blk_dev->parent.init = NULL;
         blk_dev->parent.open = NULL;
-        blk_dev->parent.close = NULL;
+        blk_dev->parent.close = blk_dev_close;
         blk_dev->parent.read = blk_dev_read;
         blk_dev->parent.write = blk_dev_write;
         blk_dev->parent.control = blk_dev_control;
@@ -202,6 +546,30 @@ struct rt_device *fal_blk_device_create(const char *parition_name)
     return RT_DEVICE(blk_dev);
 }
 
+/**
+ * write the cached sectors of all block devices back to the flash
+ *
+ * @return RT_EOK: all written back
+ *        -RT_ERROR: a sector could not be written
+ */
+int fal_blk_device_sync(void)
+{
+    rt_err_t result = RT_EOK;
+#if FAL_BLK_CACHE_NUM > 0
+    struct fal_blk_device *blk_dev;
+
+    for (blk_dev = blk_dev_list; blk_dev != RT_NULL; blk_dev = blk_dev->next)
+    {
+        if (blk_dev_control(RT_DEVICE(blk_dev), RT_DEVICE_CTRL_BLK_SYNC, RT_NULL) != RT_EOK)
+        {
+            result = -RT_ERROR;
+        }
+    }
+#endif
+
+    return result;
+}
+
 /* ========================== MTD nor device ======================== */
 #if defined(RT_USING_MTD_NOR)
 
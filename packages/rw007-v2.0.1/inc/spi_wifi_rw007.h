@@ -70,7 +70,12 @@ struct spi_slave_response
 /* spi buffer configure. */
 #define SPI_MAX_DATA_LEN 1520
 #define SPI_TX_POOL_SIZE 4
+#ifdef RT_WLAN_PROT_LWIP_PBUF_FORCE
+/* rx blocks stay with lwip until the frames are consumed */
+#define SPI_RX_POOL_SIZE 8
+#else
 #define SPI_RX_POOL_SIZE 4
+#endif
 /*  The slave interrupts wait timeout */
 #define SLAVE_INT_TIMEOUT  100
 
@@ -28,6 +28,22 @@
 
 #include "spi_wifi_rw007.h"
 
+#ifdef RT_WLAN_PROT_LWIP_PBUF_FORCE
+#include <lwip/pbuf.h>
+
+/* rx mempool block handed to lwip, returned to the pool by pbuf_free() */
+struct rw007_rx_pbuf
+{
+    struct pbuf_custom pbuf;
+    struct rw007_spi *dev;
+    struct spi_data_packet *data_packet;
+};
+
+static struct rt_mempool rx_pbuf_mp;
+ALIGN(RT_ALIGN_SIZE)
+static rt_uint8_t rx_pbuf_mempool[(sizeof(struct rw007_rx_pbuf) + 4) * SPI_RX_POOL_SIZE];
+#endif
+
 static struct rw007_spi rw007_spi;
 static struct rw007_wifi wifi_sta, wifi_ap;
 static struct rt_event spi_wifi_data_event;
@@ -45,6 +61,125 @@ typedef struct
 net_packet packet;
 #endif
 
+#ifdef RT_WLAN_PROT_LWIP_PBUF_FORCE
+/*
+ * A tx packet is either a tx mempool block or the headroom of a lwip pbuf,
+ * in which case the pbuf pointer is stored right in front of the packet.
+ */
+static void spi_tx_packet_free(struct rw007_spi *dev, const struct spi_data_packet *data_packet)
+{
+    const rt_uint8_t *addr = (const rt_uint8_t *)data_packet;
+    struct pbuf *p;
+
+    if ((addr >= dev->spi_tx_mempool) && (addr < dev->spi_tx_mempool + sizeof(dev->spi_tx_mempool)))
+    {
+        rt_mp_free((void *)data_packet);
+        return;
+    }
+
+    rt_memcpy(&p, addr - sizeof(p), sizeof(p));
+    pbuf_free(p);
+}
+
+static void rx_pbuf_free(struct pbuf *p)
+{
+    struct rw007_rx_pbuf *rx_pbuf = (struct rw007_rx_pbuf *)p;
+
+    rt_mp_free(rx_pbuf->data_packet);
+    rt_mp_free(rx_pbuf);
+}
+
+/* Wrap a received ethernet frame without copying, NULL when it should be copied */
+static struct pbuf *rx_pbuf_alloc(struct rw007_spi *dev, struct spi_data_packet *data_packet)
+{
+    struct rw007_rx_pbuf *rx_pbuf;
+
+    /* lwip may hold frames for a while, the last free block stays with the transfer thread */
+    if (dev->spi_rx_mp.block_free_count == 0)
+    {
+        return RT_NULL;
+    }
+
+    rx_pbuf = rt_mp_alloc(&rx_pbuf_mp, RT_WAITING_NO);
+    if (rx_pbuf == RT_NULL)
+    {
+        return RT_NULL;
+    }
+    rx_pbuf->dev = dev;
+    rx_pbuf->data_packet = data_packet;
+    rx_pbuf->pbuf.custom_free_function = rx_pbuf_free;
+
+    return pbuf_alloced_custom(PBUF_RAW, data_packet->data_len, PBUF_REF, &rx_pbuf->pbuf,
+                               data_packet->buffer, data_packet->data_len);
+}
+
+static void wifi_report_eth_data(struct rt_wlan_device *wlan, struct rw007_spi *dev, struct spi_data_packet *data_packet)
+{
+    struct pbuf *p = rx_pbuf_alloc(dev, data_packet);
+
+    if (p == RT_NULL)
+    {
+        p = pbuf_alloc(PBUF_RAW, data_packet->data_len, PBUF_POOL);
+        if (p == RT_NULL)
+        {
+            p = pbuf_alloc(PBUF_RAW, data_packet->data_len, PBUF_RAM);
+        }
+        if (p != RT_NULL)
+        {
+            pbuf_take(p, data_packet->buffer, data_packet->data_len);
+        }
+        rt_mp_free(data_packet);
+        if (p == RT_NULL)
+        {
+            LOG_W("rw007 pbuf allocate fail\r");
+            return;
+        }
+    }
+
+    if (rt_wlan_dev_report_data(wlan, p, p->tot_len) != RT_EOK)
+    {
+        pbuf_free(p);
+    }
+}
+#else
+#define spi_tx_packet_free(dev, data_packet) rt_mp_free((void *)(data_packet))
+#endif /* RT_WLAN_PROT_LWIP_PBUF_FORCE */
+
+/*
+ * The data phase is clocked straight from where the packet lives (tx mempool
+ * block or lwip pbuf), the rest of a longer slave data goes last.
+ */
+static void wifi_data_phase(struct rt_spi_device *rt_spi_device, const struct spi_data_packet *send_packet,
+                            uint8_t *recv_buf, rt_uint32_t length)
+{
+    struct rt_spi_message message;
+    rt_uint32_t send_len = 0;
+
+    if (send_packet != RT_NULL)
+    {
+        send_len = RT_ALIGN(send_packet->data_len + member_offset(struct spi_data_packet, buffer), 4);
+    }
+
+    message.cs_take = 0;
+    message.cs_release = 1;
+    message.send_buf = send_packet;
+    message.recv_buf = recv_buf;
+    message.length = length;
+    if ((send_len > 0) && (send_len < length))
+    {
+        /* a pbuf has no room behind the frame, do not clock out past the packet */
+        message.length = send_len;
+        message.cs_release = 0;
+        rt_spi_device->bus->ops->xfer(rt_spi_device, &message);
+
+        message.send_buf = RT_NULL;
+        message.recv_buf = (recv_buf != RT_NULL) ? recv_buf + send_len : RT_NULL;
+        message.length = length - send_len;
+        message.cs_release = 1;
+    }
+    rt_spi_device->bus->ops->xfer(rt_spi_device, &message);
+}
+
 static int wifi_data_transfer(struct rw007_spi *dev, uint16_t seq, uint8_t *rx_buffer)
 {
     static const struct spi_data_packet *send_packet = RT_NULL;
@@ -83,7 +218,7 @@ static int wifi_data_transfer(struct rw007_spi *dev, uint16_t seq, uint8_t *rx_b
         /* Invalid data packet */
         if((send_packet->data_len == 0) || (send_packet->data_len > SPI_MAX_DATA_LEN))
         {
-            rt_mp_free((void *)send_packet);
+            spi_tx_packet_free(dev, send_packet);
             send_packet = RT_NULL;
         }
         else
@@ -171,14 +306,8 @@ static int wifi_data_transfer(struct rw007_spi *dev, uint16_t seq, uint8_t *rx_b
         rx_buffer = RT_NULL;
     }
 
-    message.send_buf = send_packet;
-    message.recv_buf = rx_buffer;
-    message.length = RT_ALIGN(max_data_len, 4);/* align clk to word */
-    message.cs_take = 0;
-    message.cs_release = 1;
-
     /* Transmit data */
-    rt_spi_device->bus->ops->xfer(rt_spi_device, &message);
+    wifi_data_phase(rt_spi_device, send_packet, rx_buffer, RT_ALIGN(max_data_len, 4));/* align clk to word */
 
     /* End a SPI transmit */
     rt_spi_release_bus(rt_spi_device);
@@ -186,7 +315,7 @@ static int wifi_data_transfer(struct rw007_spi *dev, uint16_t seq, uint8_t *rx_b
     /* Free send data space */
     if ((resp.flag & SLAVE_FLAG_SRDY) && (send_packet != RT_NULL))
     {
-        rt_mp_free((void *)send_packet);
+        spi_tx_packet_free(dev, send_packet);
         send_packet = RT_NULL;
     }
 
@@ -206,8 +335,8 @@ static int wifi_data_transfer(struct rw007_spi *dev, uint16_t seq, uint8_t *rx_b
         LOG_E("The wifi slave data response timed out\r");
     }
 
-    /* The slave has data */
-    if (resp.slave_tx_buf > 0)
+    /* The slave has data, or more packets are queued to send */
+    if ((resp.slave_tx_buf > 0) || (dev->spi_tx_mb.entry > 0))
     {
         return TRANSFER_DATA_CONTINUE;
     }
@@ -287,6 +416,19 @@ static void wifi_data_process_thread_entry(void *parameter)
         /* get the mempool memory for recv data package */
         if(rt_mb_recv(&dev->spi_rx_mb, (rt_ubase_t *)&data_packet, RT_WAITING_FOREVER) == RT_EOK)
         {
+#ifdef RT_WLAN_PROT_LWIP_PBUF_FORCE
+            /* ethernet frames go to lwip in place, the block is freed with the pbuf */
+            if (data_packet->data_type == DATA_TYPE_STA_ETH_DATA)
+            {
+                wifi_report_eth_data(wifi_sta.wlan, dev, (struct spi_data_packet *)data_packet);
+                continue;
+            }
+            else if (data_packet->data_type == DATA_TYPE_AP_ETH_DATA)
+            {
+                wifi_report_eth_data(wifi_ap.wlan, dev, (struct spi_data_packet *)data_packet);
+                continue;
+            }
+#endif
             if (data_packet->data_type == DATA_TYPE_STA_ETH_DATA)
             {
                 /* Ethernet package from station device */
@@ -435,7 +577,7 @@ rt_inline void spi_send_cmd(struct rw007_spi * hspi, RW00x_CMD COMMAND, void * b
 
     data_packet->data_len = member_offset(struct rw007_cmd, value) + cmd->len;
 
-    rt_mb_send(&hspi->spi_tx_mb, (rt_ubase_t)data_packet);
+    rt_mb_send_wait(&hspi->spi_tx_mb, (rt_ubase_t)data_packet, RT_WAITING_FOREVER);
     rt_event_send(&spi_wifi_data_event, RW007_MASTER_DATA);
 }
 
@@ -660,6 +802,40 @@ static int wlan_send(struct rt_wlan_device *wlan, void *buff, int len)
         return -1;
     }
 
+#ifdef RT_WLAN_PROT_LWIP_PBUF_FORCE
+    {
+        struct pbuf *p = (struct pbuf *)buff;
+        rt_uint32_t data_type = (wlan == wifi_sta.wlan) ? DATA_TYPE_STA_ETH_DATA : DATA_TYPE_AP_ETH_DATA;
+        rt_uint32_t data_len = p->tot_len;
+        rt_uint8_t *frame = p->payload;
+
+        /* a single pbuf with enough headroom is sent in place, see PBUF_LINK_ENCAPSULATION_HLEN */
+        if ((p->len == p->tot_len) && (pbuf_header(p, sizeof(p) + member_offset(struct spi_data_packet, buffer)) == 0))
+        {
+            data_packet = (struct spi_data_packet *)(frame - member_offset(struct spi_data_packet, buffer));
+            /* the headroom is not word aligned behind an ethernet header */
+            rt_memcpy(p->payload, &p, sizeof(p));
+            rt_memcpy(&data_packet->data_len, &data_len, sizeof(data_len));
+            rt_memcpy(&data_packet->data_type, &data_type, sizeof(data_type));
+            pbuf_header(p, -(s16_t)(sizeof(p) + member_offset(struct spi_data_packet, buffer)));
+            pbuf_ref(p);
+
+            rt_mb_send_wait(&hspi->spi_tx_mb, (rt_ubase_t)data_packet, RT_WAITING_FOREVER);
+            rt_event_send(&spi_wifi_data_event, RW007_MASTER_DATA);
+            return len;
+        }
+
+        data_packet = rt_mp_alloc(&hspi->spi_tx_mp, RT_WAITING_FOREVER);
+        data_packet->data_type = data_type;
+        data_packet->data_len = data_len;
+        pbuf_copy_partial(p, data_packet->buffer, data_len, 0);
+
+        rt_mb_send_wait(&hspi->spi_tx_mb, (rt_ubase_t)data_packet, RT_WAITING_FOREVER);
+        rt_event_send(&spi_wifi_data_event, RW007_MASTER_DATA);
+        return len;
+    }
+#endif
+
     data_packet = rt_mp_alloc(&hspi->spi_tx_mp, RT_WAITING_FOREVER);
 
     if (wlan == wifi_sta.wlan)
@@ -674,7 +850,7 @@ static int wlan_send(struct rt_wlan_device *wlan, void *buff, int len)
 
     rt_memcpy(data_packet->buffer, buff, len);
 
-    rt_mb_send(&hspi->spi_tx_mb, (rt_ubase_t)data_packet);
+    rt_mb_send_wait(&hspi->spi_tx_mb, (rt_ubase_t)data_packet, RT_WAITING_FOREVER);
     rt_event_send(&spi_wifi_data_event, RW007_MASTER_DATA);
     return len;
 }
@@ -763,6 +939,15 @@ rt_err_t rt_hw_wifi_init(const char *spi_device_name)
                SPI_RX_POOL_SIZE,
                RT_IPC_FLAG_PRIO);
 
+#ifdef RT_WLAN_PROT_LWIP_PBUF_FORCE
+    /* one pbuf wrapper per rx block */
+    rt_mp_init(&rx_pbuf_mp,
+               "rx_pbuf",
+               &rx_pbuf_mempool[0],
+               sizeof(rx_pbuf_mempool),
+               sizeof(struct rw007_rx_pbuf));
+#endif
+
     /* init spi data notify event */
     rt_event_init(&spi_wifi_data_event, "wifi", RT_IPC_FLAG_FIFO);
 
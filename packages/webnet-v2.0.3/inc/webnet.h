@@ -88,6 +88,19 @@ extern "C" {
 #define WEBNET_PATH_MAX                256          /* maxiaml path length in webnet */
 #define WEBNET_SERVER                  "Server: webnet "WEBNET_VERSION"\r\n"
 
+#ifndef WEBNET_ARENA_SIZE
+#define WEBNET_ARENA_SIZE              512          /* request memory arena size in session */
+#endif
+
+#ifdef WEBNET_USING_KEEPALIVE
+#ifndef WEBNET_KEEPALIVE_TIMEOUT
+#define WEBNET_KEEPALIVE_TIMEOUT       5            /* idle timeout (second) of keep-alive session */
+#endif
+#ifndef WEBNET_KEEPALIVE_MAX
+#define WEBNET_KEEPALIVE_MAX           100          /* maximal requests on one keep-alive session */
+#endif
+#endif /* WEBNET_USING_KEEPALIVE */
+
 /* Pre-declaration */
 struct webnet_session;
 /* webnet query item definitions */
@@ -25,6 +25,7 @@
 #define __WN_SESSION_H__
 
 #include <sys/select.h>
+#include <webnet.h>
 #include <wn_request.h>
 
 #ifdef RT_USING_SAL
@@ -62,6 +63,8 @@ enum webnet_session_phase
     WEB_PHASE_CLOSE,        /* to close session */
 };
 
+struct webnet_arena_chunk;
+
 struct webnet_session
 {
     struct webnet_session *next;
@@ -81,6 +84,18 @@ struct webnet_session
     /* session phase */
     rt_uint32_t  session_phase;
 
+    /* memory arena for the current request, reset at the end of request */
+    struct webnet_arena_chunk* arena;
+    struct webnet_arena_chunk* arena_chunk;
+
+#ifdef WEBNET_USING_KEEPALIVE
+    /* keep-alive connection */
+    rt_uint16_t request_count;
+    rt_uint16_t pipeline_length;
+    rt_uint8_t* pipeline_buffer;
+    rt_tick_t   idle_tick;
+#endif /* WEBNET_USING_KEEPALIVE */
+
     rt_uint32_t  session_event_mask;
     const struct webnet_session_ops* session_ops;
     rt_uint32_t user_data;
@@ -91,6 +106,9 @@ struct webnet_session* webnet_session_create(int listenfd);
 int  webnet_session_read(struct webnet_session *session, char *buffer, int length);
 void webnet_session_close(struct webnet_session *session);
 
+void* webnet_session_alloc(struct webnet_session *session, rt_size_t size);
+char* webnet_session_strdup(struct webnet_session *session, const char* str);
+
 void webnet_session_printf(struct webnet_session *session, const char* fmt, ...);
 int  webnet_session_write(struct webnet_session *session, const rt_uint8_t* data, rt_size_t size);
 int  webnet_session_redirect(struct webnet_session *session, const char* url);
@@ -100,6 +118,9 @@ void webnet_session_set_header_status_line(struct webnet_session *session, int c
 
 int webnet_sessions_set_fds(fd_set *readset, fd_set *writeset);
 void webnet_sessions_handle_fds(fd_set *readset, fd_set *writeset);
+#ifdef WEBNET_USING_KEEPALIVE
+void webnet_sessions_handle_idle(void);
+#endif
 
 void webnet_sessions_set_err_callback(void (*callback)(struct webnet_session *session));
 
@@ -76,7 +76,7 @@ int webnet_module_alias(struct webnet_session* session, int event)
             if (str_path_with(request->path, _alias_items[index].old_path))
             {
                 char* map_path;
-                map_path = (char*) wn_malloc (WEBNET_PATH_MAX);
+                map_path = (char*) webnet_session_alloc(session, WEBNET_PATH_MAX);
                 RT_ASSERT(map_path != RT_NULL);
 
                 rt_snprintf(map_path, WEBNET_PATH_MAX, "%s/%s",
@@ -84,7 +84,6 @@ int webnet_module_alias(struct webnet_session* session, int event)
                             request->path + strlen(_alias_items[index].old_path));
 
                 /* set new path */
-                wn_free(request->path);
                 request->path = map_path;
 
                 return WEBNET_MODULE_CONTINUE;
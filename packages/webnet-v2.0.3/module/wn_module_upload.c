@@ -60,6 +60,9 @@ static rt_uint16_t _upload_entries_count = 0;
 struct webnet_module_upload_session
 {
     char* boundary;
+    /* "\r\n" boundary and "\r\n" boundary "--\r\n" for searching in data */
+    char* common_boundary;
+    char* last_boundary;
 
     char* filename;
     char* content_type;
@@ -120,45 +123,6 @@ __found:
     return 0;
 }
 
-/* Search string array on binary data */
-static char* memstrs(const char* str, size_t length, int num, ...)
-{
-    char *substr;
-    char *index_str, *ptr;
-
-    va_list args;
-    int index;
-    int total_size;
-
-    /* get the match total string length */
-    va_start(args, num);
-    total_size = 0;
-    for (index = 0; index < num; index ++)
-    {
-        index_str = va_arg(args, char*);
-        total_size += strlen(index_str);
-    }
-    va_end(args);
-
-    substr = wn_malloc(total_size + 1);
-    ptr = substr;
-    va_start(args, num);
-    for (index = 0; index < num; index++)
-    {
-        index_str = va_arg(args, char*);
-        rt_memcpy(ptr, index_str, strlen(index_str));
-        ptr += strlen(index_str);
-    }
-    substr[total_size] = '\0';
-    va_end(args);
-
-    /* find in binary data */
-    ptr = memstr(str, length, substr);
-    wn_free(substr);
-
-    return ptr;
-}
-
 #if !(defined(__GNUC__) && !defined(__ARMCC_VERSION)/*GCC*/)
 static void* memrchr(const void *s, int c, size_t n)
 {
@@ -208,9 +172,6 @@ static char* _webnet_module_upload_parse_header(struct webnet_session* session,
             upload_session->content_type != RT_NULL)
     {
         /* end of file name section */
-        wn_free(upload_session->filename);
-        wn_free(upload_session->content_type);
-
         upload_session->filename = RT_NULL;
         upload_session->content_type = RT_NULL;
     }
@@ -281,43 +242,35 @@ static char* _webnet_module_upload_parse_header(struct webnet_session* session,
         {
             ptr += 2;
 
-            if (upload_session->filename != RT_NULL)
-            {
-                wn_free(upload_session->filename);
-                upload_session->filename = RT_NULL;
-            }
-            if (upload_session->content_type != RT_NULL)
-            {
-                wn_free(upload_session->content_type);
-                upload_session->content_type = RT_NULL;
-            }
+            upload_session->filename = RT_NULL;
+            upload_session->content_type = RT_NULL;
 
             if (filename != RT_NULL)
             {
-                upload_session->filename = wn_strdup(filename);
+                upload_session->filename = webnet_session_strdup(session, filename);
             }
             if (content_type != RT_NULL)
             {
-                upload_session->content_type = wn_strdup(content_type);
+                upload_session->content_type = webnet_session_strdup(session, content_type);
             }
             if (name != RT_NULL)
             {
-                /* add a name entry in the upload session */
-                if (upload_session->name_entries == RT_NULL)
-                {
-                    upload_session->name_entries_count = 1;
-                    upload_session->name_entries = (struct webnet_upload_name_entry*)
-                                                   wn_malloc(sizeof(struct webnet_upload_name_entry));
-                }
-                else
+                struct webnet_upload_name_entry* name_entries;
+
+                /* add a name entry in the upload session, the old entries are released with request */
+                name_entries = (struct webnet_upload_name_entry*) webnet_session_alloc(session,
+                               sizeof(struct webnet_upload_name_entry) * (upload_session->name_entries_count + 1));
+                if (name_entries == RT_NULL) return ptr;
+
+                if (upload_session->name_entries_count > 0)
                 {
-                    upload_session->name_entries_count += 1;
-                    upload_session->name_entries = (struct webnet_upload_name_entry*)
-                                                   wn_realloc(upload_session->name_entries,
-                                                           sizeof(struct webnet_upload_name_entry) * upload_session->name_entries_count);
+                    rt_memcpy(name_entries, upload_session->name_entries,
+                              sizeof(struct webnet_upload_name_entry) * upload_session->name_entries_count);
                 }
+                upload_session->name_entries = name_entries;
+                upload_session->name_entries_count += 1;
 
-                upload_session->name_entries[upload_session->name_entries_count - 1].name = wn_strdup(name);
+                upload_session->name_entries[upload_session->name_entries_count - 1].name = webnet_session_strdup(session, name);
                 upload_session->name_entries[upload_session->name_entries_count - 1].value = RT_NULL;
             }
 
@@ -347,7 +300,7 @@ static char* _next_possible_boundary(struct webnet_session* session, char* buffe
     /* try the beginning */
     if (str_begin_with_strs(buffer, COMMON_BOUNDARY)) return buffer;
     /* search in all the string */
-    ptr = memstrs(buffer, length, COMMON_BOUNDARY);
+    ptr = memstr(buffer, length, upload_session->common_boundary);
     if (ptr != RT_NULL) return ptr;
 
     /* search from the end of string */
@@ -355,6 +308,8 @@ static char* _next_possible_boundary(struct webnet_session* session, char* buffe
     if (ptr == RT_NULL ) return RT_NULL;
     if (ptr - buffer == length - 1) return ptr; /* only \r */
     if (*(ptr + 1) == '\n' && ptr - buffer == length - 2) return RT_NULL; /* only \r\n */
+    /* a tail longer than the boundary is not a partial boundary */
+    if (length - (ptr - buffer + 2) > strlen(upload_session->boundary)) return RT_NULL;
 
     if (memcmp(ptr + 2, upload_session->boundary, length - (ptr - buffer + 2)) == 0) return ptr;
 
@@ -381,10 +336,12 @@ static void _handle_section(struct webnet_session* session, char* buffer, rt_siz
     {
         /* get name value */
         ptr = memstr(buffer, length, "\r\n");
-        if (ptr != RT_NULL)
+        if (ptr != RT_NULL && upload_session->name_entries_count > 0)
         {
             int value_size = ptr - buffer + 1;
-            name_entry.value = wn_malloc(value_size);
+            name_entry.value = webnet_session_alloc(session, value_size);
+            if (name_entry.value == RT_NULL) return;
+
             rt_memcpy(name_entry.value, buffer, value_size - 1);
             name_entry.value[value_size - 1] = '\0';
         }
@@ -406,7 +363,7 @@ static void _webnet_module_upload_handle(struct webnet_session* session, int eve
     upload_buffer = (char*)session->buffer;
 
     /* read stream */
-    if (memstrs((const char *)session->buffer, session->buffer_offset, LAST_BOUNDARY))
+    if (memstr((const char *)session->buffer, session->buffer_offset, upload_session->last_boundary))
     {
         length = session->buffer_offset;
     }
@@ -454,7 +411,7 @@ static void _webnet_module_upload_handle(struct webnet_session* session, int eve
 
         /* read more data */
         if (end_ptr - upload_buffer < sizeof(session->buffer)/3 &&
-                memstrs(upload_buffer, end_ptr - upload_buffer, LAST_BOUNDARY) == RT_NULL)
+                memstr(upload_buffer, end_ptr - upload_buffer, upload_session->last_boundary) == RT_NULL)
         {
             /* read more data */
             rt_memmove(session->buffer, upload_buffer, end_ptr - upload_buffer);
@@ -541,27 +498,7 @@ static void _webnet_module_upload_close(struct webnet_session* session)
         upload_session->file_opened = 0;
     }
 
-    /* free session */
-    if (upload_session->filename != RT_NULL)
-        wn_free(upload_session->filename);
-    if (upload_session->content_type != RT_NULL)
-        wn_free(upload_session->content_type);
-    if (upload_session->boundary != RT_NULL)
-        wn_free(upload_session->boundary);
-    if (upload_session->entry != RT_NULL)
-    {
-        rt_uint32_t index;
-        for (index = 0; index < upload_session->name_entries_count; index ++)
-        {
-            if (upload_session->name_entries[index].value != RT_NULL)
-                wn_free(upload_session->name_entries[index].value);
-            if (upload_session->name_entries[index].name != RT_NULL)
-                wn_free(upload_session->name_entries[index].name);
-        }
-        wn_free(upload_session->name_entries);
-        upload_session->name_entries = RT_NULL;
-    }
-    wn_free(upload_session);
+    /* the upload session is in the memory arena of session, which is reset with request */
 
     /* remove private data */
     session->user_data = 0;
@@ -604,21 +541,23 @@ int webnet_module_upload_open(struct webnet_session* session)
         return WEBNET_MODULE_CONTINUE;
 
     /* create a uploading session */
-    upload_session = (struct webnet_module_upload_session*) wn_malloc (
+    upload_session = (struct webnet_module_upload_session*) webnet_session_alloc(session,
                          sizeof (struct webnet_module_upload_session));
     if (upload_session == RT_NULL) return 0; /* no memory */
 
     /* get boundary */
     boundary = strstr(session->request->content_type, BOUNDARY_STRING);
-    if (boundary != RT_NULL)
-    {
-        int boundary_size;
-
-        /* make boundary */
-        boundary_size = strlen(boundary + sizeof(BOUNDARY_STRING) - 1) + 3;
-        upload_session->boundary = wn_malloc(boundary_size);
-        rt_sprintf(upload_session->boundary, "--%s", boundary + sizeof(BOUNDARY_STRING) - 1);
-    }
+    if (boundary == RT_NULL) return 0; /* not a multipart request */
+    boundary += sizeof(BOUNDARY_STRING) - 1;
+
+    /* make boundary strings: "\r\n--" boundary "--\r\n" */
+    upload_session->last_boundary = webnet_session_alloc(session, strlen(boundary) + 9);
+    if (upload_session->last_boundary == RT_NULL) return 0; /* no memory */
+    rt_sprintf(upload_session->last_boundary, "\r\n--%s--\r\n", boundary);
+    upload_session->common_boundary = webnet_session_strdup(session, upload_session->last_boundary);
+    if (upload_session->common_boundary == RT_NULL) return 0; /* no memory */
+    upload_session->common_boundary[strlen(boundary) + 4] = '\0';
+    upload_session->boundary = upload_session->common_boundary + 2;
     upload_session->filename = RT_NULL;
     upload_session->content_type = RT_NULL;
     upload_session->name_entries = RT_NULL;
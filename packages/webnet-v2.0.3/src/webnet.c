@@ -86,6 +86,9 @@ static void webnet_thread(void *parameter)
     int sock_fd, maxfdp1;
     struct sockaddr_in webnet_saddr;
     struct timeval rcv_to = {0, 50000};
+#ifdef WEBNET_USING_KEEPALIVE
+    struct timeval select_to;
+#endif
 
     /* First acquire our socket for listening for connections */
     listenfd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
@@ -126,6 +129,11 @@ static void webnet_thread(void *parameter)
     /* Wait forever for network input: This could be connections or data */
     for (;;)
     {
+#ifdef WEBNET_USING_KEEPALIVE
+        /* close the keep-alive sessions which are idle too long */
+        webnet_sessions_handle_idle();
+#endif
+
         /* Determine what sockets need to be in readset */
         FD_ZERO(&readset);
         FD_ZERO(&writeset);
@@ -141,8 +149,16 @@ static void webnet_thread(void *parameter)
         /* use temporary fd set in select */
         tempfds = readset;
         tempwrtfds = writeset;
+#ifdef WEBNET_USING_KEEPALIVE
+        /* wake up every second to close the idle keep-alive sessions */
+        select_to.tv_sec = 1;
+        select_to.tv_usec = 0;
+        /* Wait for data or a new connection */
+        sock_fd = select(maxfdp1, &tempfds, &tempwrtfds, 0, &select_to);
+#else
         /* Wait for data or a new connection */
         sock_fd = select(maxfdp1, &tempfds, &tempwrtfds, 0, 0);
+#endif
         if (sock_fd == 0)
         {
             continue;
@@ -528,7 +528,7 @@ int webnet_module_handle_uri(struct webnet_session *session)
     if (result == WEBNET_MODULE_FINISHED) return result;
 
     /* made a full physical path */
-    full_path = (char *) wn_malloc(WEBNET_PATH_MAX);
+    full_path = (char *) webnet_session_alloc(session, WEBNET_PATH_MAX);
     RT_ASSERT(full_path != RT_NULL);
 
     /* only GET or POST need try default page. */
@@ -571,7 +571,6 @@ _end_default_files:
     }
 
     /* mark path as full physical path */
-    wn_free(request->path);
     request->path = full_path;
 
     /* check uri valid */
@@ -76,8 +76,8 @@ static void _webnet_request_parse_query(struct webnet_request* request)
     if (request->query_counter == 0) return; /* no query */
 
     /* allocate query item */
-    request->query_items = (struct webnet_query_item*) wn_malloc (sizeof(struct webnet_query_item)
-                           * request->query_counter);
+    request->query_items = (struct webnet_query_item*) webnet_session_alloc(request->session,
+                           sizeof(struct webnet_query_item) * request->query_counter);
     if (request->query_items == RT_NULL)
     {
         request->result_code = 500;
@@ -122,7 +122,9 @@ static void _webnet_request_parse_query(struct webnet_request* request)
  */
 static void _webnet_request_copy_str(struct webnet_request* request)
 {
-    if (request->path != RT_NULL) request->path = wn_strdup(request->path);
+    struct webnet_session *session = request->session;
+
+    if (request->path != RT_NULL) request->path = webnet_session_strdup(session, request->path);
     if (request->host != RT_NULL)
     {
         char *ptr;
@@ -130,26 +132,26 @@ static void _webnet_request_copy_str(struct webnet_request* request)
         while (*ptr && *ptr != ':') ptr ++;
         if (*ptr == ':') *ptr = '\0';
 
-        request->host = wn_strdup(request->host);
+        request->host = webnet_session_strdup(session, request->host);
     }
-    if (request->cookie != RT_NULL) request->cookie = wn_strdup(request->cookie);
-    if (request->user_agent != RT_NULL) request->user_agent = wn_strdup(request->user_agent);
-    if (request->authorization != RT_NULL) request->authorization = wn_strdup(request->authorization);
-    if (request->accept_language != RT_NULL) request->accept_language = wn_strdup(request->accept_language);
-    if (request->referer != RT_NULL) request->referer = wn_strdup(request->referer);
-    if (request->content_type != RT_NULL) request->content_type = wn_strdup(request->content_type);
+    if (request->cookie != RT_NULL) request->cookie = webnet_session_strdup(session, request->cookie);
+    if (request->user_agent != RT_NULL) request->user_agent = webnet_session_strdup(session, request->user_agent);
+    if (request->authorization != RT_NULL) request->authorization = webnet_session_strdup(session, request->authorization);
+    if (request->accept_language != RT_NULL) request->accept_language = webnet_session_strdup(session, request->accept_language);
+    if (request->referer != RT_NULL) request->referer = webnet_session_strdup(session, request->referer);
+    if (request->content_type != RT_NULL) request->content_type = webnet_session_strdup(session, request->content_type);
 
     /* DMR */
-    if (request->callback) request->callback = wn_strdup(request->callback);
-    if (request->soap_action) request->soap_action = wn_strdup(request->soap_action);
-    if (request->sid) request->sid = wn_strdup(request->sid);
+    if (request->callback) request->callback = webnet_session_strdup(session, request->callback);
+    if (request->soap_action) request->soap_action = webnet_session_strdup(session, request->soap_action);
+    if (request->sid) request->sid = webnet_session_strdup(session, request->sid);
 
     /* DAV */
 #ifdef WEBNET_USING_DAV
-    if (request->depth) request->depth = wn_strdup(request->depth);
+    if (request->depth) request->depth = webnet_session_strdup(session, request->depth);
 #endif
 #ifdef WEBNET_USING_RANGE
-    if (request->Range) request->Range = wn_strdup(request->Range);
+    if (request->Range) request->Range = webnet_session_strdup(session, request->Range);
 #endif /* WEBNET_USING_RANGE */
     request->field_copied = RT_TRUE;
 }
@@ -256,7 +258,7 @@ int webnet_request_parse_method(struct webnet_request *request, char* buffer, in
         return request_buffer - buffer;
     }
     *ch++ = '\0';
-    request->path = wn_strdup(request_buffer);
+    request->path = webnet_session_strdup(request->session, request_buffer);
     request_buffer = ch;
 
     /* check path, whether there is a query */
@@ -267,7 +269,7 @@ int webnet_request_parse_method(struct webnet_request *request, char* buffer, in
         while (*ch == ' ') ch ++;
 
         /* copy query and parse query */
-        request->query = wn_strdup(ch);
+        request->query = webnet_session_strdup(request->session, ch);
         /* copy query and parse parameter */
         _webnet_request_parse_query(request);
     }
@@ -280,6 +282,12 @@ int webnet_request_parse_method(struct webnet_request *request, char* buffer, in
         return request_buffer - buffer;
     }
 
+#ifdef WEBNET_USING_KEEPALIVE
+    /* HTTP/1.1 connection is persistent by default */
+    if (str_begin_with(request_buffer, "HTTP/1.1"))
+        request->connection = WEBNET_CONN_KEEPALIVE;
+#endif
+
     ch = strstr(request_buffer, "\r\n");
     *ch ++ = '\0';
     *ch ++ = '\0';
@@ -319,10 +327,7 @@ int webnet_request_parse_header(struct webnet_request *request, char* buffer, in
                     session->session_phase = WEB_PHASE_QUERY;
 
                     /* allocate query buffer */
-                    if(request->query != RT_NULL) {
-                       wn_free(request->query);
-                    }
-                    request->query = (char*) wn_malloc(request->content_length + 1);
+                    request->query = (char*) webnet_session_alloc(session, request->content_length + 1);
                     rt_memset(request->query, 0, request->content_length + 1);
                     request->query_offset = 0;
                 }
@@ -358,21 +363,21 @@ int webnet_request_parse_header(struct webnet_request *request, char* buffer, in
             /* get host */
             request_buffer += 5;
             while (*request_buffer == ' ') request_buffer ++;
-            request->host = wn_strdup(request_buffer);
+            request->host = webnet_session_strdup(session, request_buffer);
         }
         else if (str_begin_with(request_buffer, "User-Agent:"))
         {
             /* get user agent */
             request_buffer += 11;
             while (*request_buffer == ' ') request_buffer ++;
-            request->user_agent = wn_strdup(request_buffer);
+            request->user_agent = webnet_session_strdup(session, request_buffer);
         }
         else if (str_begin_with(request_buffer, "Accept-Language:"))
         {
             /* get accept language */
             request_buffer += 16;
             while (*request_buffer == ' ') request_buffer ++;
-            request->accept_language = wn_strdup(request_buffer);
+            request->accept_language = webnet_session_strdup(session, request_buffer);
         }
         else if (str_begin_with(request_buffer, "Content-Length:"))
         {
@@ -386,14 +391,14 @@ int webnet_request_parse_header(struct webnet_request *request, char* buffer, in
             /* get content type */
             request_buffer += 13;
             while (*request_buffer == ' ') request_buffer ++;
-            request->content_type = wn_strdup(request_buffer);
+            request->content_type = webnet_session_strdup(session, request_buffer);
         }
         else if (str_begin_with(request_buffer, "Referer:"))
         {
             /* get referer */
             request_buffer += 8;
             while (*request_buffer == ' ') request_buffer ++;
-            request->referer = wn_strdup(request_buffer);
+            request->referer = webnet_session_strdup(session, request_buffer);
         }
 #ifdef WEBNET_USING_RANGE
         else if (str_begin_with(request_buffer, "Range:"))
@@ -401,7 +406,7 @@ int webnet_request_parse_header(struct webnet_request *request, char* buffer, in
             /* get range */
             request_buffer += 6;
             while (*request_buffer == ' ') request_buffer ++;
-            request->Range = wn_strdup(request_buffer);
+            request->Range = webnet_session_strdup(session, request_buffer);
         }
 #endif /* WEBNET_USING_RANGE */
 #ifdef WEBNET_USING_DAV
@@ -409,13 +414,13 @@ int webnet_request_parse_header(struct webnet_request *request, char* buffer, in
         {
             request_buffer += 6;
             while (*request_buffer == ' ') request_buffer ++;
-            request->depth = wn_strdup(request_buffer);
+            request->depth = webnet_session_strdup(session, request_buffer);
         }
         else if (str_begin_with(request_buffer, "Destination:"))
         {
             request_buffer += 12;
             while (*request_buffer == ' ') request_buffer ++;
-            request->destination = wn_strdup(request_buffer);
+            request->destination = webnet_session_strdup(session, request_buffer);
         }
 #endif /* WEBNET_USING_DAV */
 #ifdef WEBNET_USING_KEEPALIVE
@@ -440,7 +445,7 @@ int webnet_request_parse_header(struct webnet_request *request, char* buffer, in
             /* get cookie */
             request_buffer += 7;
             while (*request_buffer == ' ') request_buffer ++;
-            request->cookie = wn_strdup(request_buffer);
+            request->cookie = webnet_session_strdup(session, request_buffer);
         }
 #endif /* WEBNET_USING_COOKIE */
 #ifdef WEBNET_USING_AUTH
@@ -449,7 +454,7 @@ int webnet_request_parse_header(struct webnet_request *request, char* buffer, in
             /* get authorization */
             request_buffer += 20;
             while (*request_buffer == ' ') request_buffer ++;
-            request->authorization = wn_strdup(request_buffer);
+            request->authorization = webnet_session_strdup(session, request_buffer);
         }
 #endif /* WEBNET_USING_AUTH */
 #if WEBNET_CACHE_LEVEL > 0
@@ -458,7 +463,7 @@ int webnet_request_parse_header(struct webnet_request *request, char* buffer, in
             /* get If-Modified-Since */
             request_buffer += 18;
             while (*request_buffer == ' ') request_buffer ++;
-            request->modified = wn_strdup(request_buffer);
+            request->modified = webnet_session_strdup(session, request_buffer);
         }
 #endif /* WEBNET_CACHE_LEVEL > 0 */
 #ifdef WEBNET_USING_GZIP
@@ -477,14 +482,14 @@ int webnet_request_parse_header(struct webnet_request *request, char* buffer, in
             request_buffer += 11;
             while (*request_buffer == ' ') request_buffer ++;
 
-            request->soap_action = wn_strdup(request_buffer);
+            request->soap_action = webnet_session_strdup(session, request_buffer);
         }
         else if (str_begin_with(request_buffer, "CALLBACK:"))
         {
             request_buffer += 9;
             while (*request_buffer == ' ') request_buffer ++;
 
-            request->callback = wn_strdup(request_buffer);
+            request->callback = webnet_session_strdup(session, request_buffer);
         }
 
         request_buffer = ch;
@@ -507,8 +512,8 @@ int webnet_request_parse_post(struct webnet_request* request, char* buffer, int
 
         if (request->query_offset == request->content_length)
         {
-            /* set terminal charater */
-            buffer[request->content_length] = '\0';
+            /* set terminal charater, the rest of buffer may be a pipelined request */
+            request->query[request->content_length] = '\0';
 
             /* parse query */
             if (str_begin_with(request->content_type, "application/x-www-form-urlencoded"))
@@ -634,7 +639,7 @@ void webnet_request_parse(struct webnet_request* request, char* buffer, int leng
         while (*ch == ' ') ch ++;
 
         /* copy query and parse query */
-        request->query = wn_strdup(ch);
+        request->query = webnet_session_strdup(request->session, ch);
         /* copy query and parse parameter */
         _webnet_request_parse_query(request);
     }
@@ -709,7 +714,7 @@ void webnet_request_parse(struct webnet_request* request, char* buffer, int leng
                 }
 
                 /* allocate a new query content and copy the already read content */
-                read_ptr = (char *)wn_malloc(request->content_length);
+                read_ptr = (char *)webnet_session_alloc(session, request->content_length);
                 if (read_ptr == RT_NULL)
                 {
                     LOG_E("No memory for request read buffer!");
@@ -737,7 +742,6 @@ void webnet_request_parse(struct webnet_request* request, char* buffer, int leng
                     if (read_bytes < 0)
                     {
                         /* read failed and session should been closed. */
-                        wn_free(request->query);
                         request->query = RT_NULL;
                         return;
                     }
@@ -924,32 +928,7 @@ void webnet_request_destory(struct webnet_request* request)
 {
     if (request != RT_NULL)
     {
-        // if (request->field_copied == RT_TRUE)
-        {
-            if (request->path != RT_NULL) wn_free(request->path);
-            if (request->host != RT_NULL) wn_free(request->host);
-            if (request->cookie != RT_NULL) wn_free(request->cookie);
-            if (request->user_agent != RT_NULL) wn_free(request->user_agent);
-            if (request->authorization != RT_NULL) wn_free(request->authorization);
-            if (request->accept_language != RT_NULL) wn_free(request->accept_language);
-            if (request->referer != RT_NULL) wn_free(request->referer);
-            if (request->content_type != RT_NULL) wn_free(request->content_type);
-            if (request->query != RT_NULL) wn_free(request->query);
-            if (request->query_items != RT_NULL) wn_free(request->query_items);
-
-            if (request->callback) wn_free(request->callback);
-            if (request->soap_action) wn_free(request->soap_action);
-            if (request->sid) wn_free(request->sid);
-#if (WEBNET_CACHE_LEVEL > 0)
-            if(request->modified) wn_free(request->modified);
-#endif
-#ifdef WEBNET_USING_RANGE
-            if (request->Range) wn_free(request->Range);
-#endif /* WEBNET_USING_RANGE */
-#ifdef WEBNET_USING_DAV
-            if (request->depth) wn_free(request->depth);
-#endif
-        }
+        /* the string fields are in the memory arena of session, which is reset with request */
 
         /* free request memory block */
         wn_free(request);
@@ -30,6 +30,15 @@
 #include <wn_module.h>
 #include <wn_utils.h>
 
+/* a heap chunk of the session memory arena, the first one is kept for the session */
+struct webnet_arena_chunk
+{
+    struct webnet_arena_chunk *next;
+    rt_size_t size;
+    rt_size_t offset;
+};
+#define ARENA_CHUNK_HEAD_SIZE   RT_ALIGN(sizeof(struct webnet_arena_chunk), RT_ALIGN_SIZE)
+
 static struct webnet_session *_session_list = 0;
 
 static void (*webnet_err_callback)(struct webnet_session *session);
@@ -72,6 +81,9 @@ struct webnet_session* webnet_session_create(int listenfd)
 
         /* initial buffer length */
         session->buffer_length = WEBNET_SESSION_BUFSZ;
+#ifdef WEBNET_USING_KEEPALIVE
+        session->idle_tick = rt_tick_get();
+#endif
     }
 
     return session;
@@ -95,6 +107,11 @@ int webnet_session_read(struct webnet_session *session, char *buffer, int length
     if (read_count <= 0)
     {
         session->session_phase = WEB_PHASE_CLOSE;
+#ifdef WEBNET_USING_KEEPALIVE
+        /* the connection is broken, never keep it alive */
+        if (session->request != RT_NULL)
+            session->request->connection = WEBNET_CONN_CLOSE;
+#endif
         return -1;
     }
 
@@ -102,6 +119,105 @@ int webnet_session_read(struct webnet_session *session, char *buffer, int length
 }
 RTM_EXPORT(webnet_session_read);
 
+static void *_webnet_arena_bump(struct webnet_arena_chunk *chunk, rt_size_t size)
+{
+    rt_ubase_t base, ptr;
+
+    base = (rt_ubase_t)chunk + ARENA_CHUNK_HEAD_SIZE;
+    ptr = RT_ALIGN(base + chunk->offset, RT_ALIGN_SIZE);
+    if (ptr + size > base + chunk->size) return RT_NULL;
+
+    chunk->offset = ptr + size - base;
+
+    return (void *)ptr;
+}
+
+static struct webnet_arena_chunk *_webnet_arena_chunk_create(rt_size_t size)
+{
+    struct webnet_arena_chunk *chunk;
+
+    chunk = (struct webnet_arena_chunk *)wn_malloc(ARENA_CHUNK_HEAD_SIZE + size);
+    if (chunk == RT_NULL) return RT_NULL;
+
+    chunk->next = RT_NULL;
+    chunk->size = size;
+    chunk->offset = 0;
+
+    return chunk;
+}
+
+/**
+ * allocate memory for the current request of session. The memory is freed
+ * together at the end of request, never free it one by one.
+ *
+ * @param session, the web session
+ * @param size, the size of memory
+ *
+ * @return the allocated memory, RT_NULL on no memory
+ */
+void* webnet_session_alloc(struct webnet_session *session, rt_size_t size)
+{
+    void *ptr;
+    struct webnet_arena_chunk *chunk;
+
+    /* the arena is allocated by the first request and kept until the session is closed */
+    if (session->arena == RT_NULL)
+    {
+        session->arena = _webnet_arena_chunk_create(WEBNET_ARENA_SIZE);
+        if (session->arena == RT_NULL) return RT_NULL;
+    }
+
+    chunk = session->arena_chunk != RT_NULL ? session->arena_chunk : session->arena;
+    ptr = _webnet_arena_bump(chunk, size);
+    if (ptr != RT_NULL) return ptr;
+
+    /* arena is used up, link a new chunk */
+    chunk = _webnet_arena_chunk_create(size > WEBNET_ARENA_SIZE ? size : WEBNET_ARENA_SIZE);
+    if (chunk == RT_NULL) return RT_NULL;
+
+    chunk->next = session->arena_chunk;
+    session->arena_chunk = chunk;
+
+    return _webnet_arena_bump(chunk, size);
+}
+RTM_EXPORT(webnet_session_alloc);
+
+/**
+ * duplicate a string in the memory arena of session
+ *
+ * @param session, the web session
+ * @param str, the string
+ *
+ * @return the duplicated string, RT_NULL on no memory
+ */
+char* webnet_session_strdup(struct webnet_session *session, const char* str)
+{
+    char *ptr;
+    rt_size_t length;
+
+    length = rt_strlen(str) + 1;
+    ptr = (char *)webnet_session_alloc(session, length);
+    if (ptr != RT_NULL) rt_memcpy(ptr, str, length);
+
+    return ptr;
+}
+RTM_EXPORT(webnet_session_strdup);
+
+static void _webnet_session_arena_reset(struct webnet_session *session)
+{
+    struct webnet_arena_chunk *chunk;
+
+    while (session->arena_chunk != RT_NULL)
+    {
+        chunk = session->arena_chunk;
+        session->arena_chunk = chunk->next;
+        wn_free(chunk);
+    }
+
+    if (session->arena != RT_NULL)
+        session->arena->offset = 0;
+}
+
 /**
  * close a webnet session
  *
@@ -142,6 +258,14 @@ void webnet_session_close(struct webnet_session *session)
         webnet_request_destory(session->request);
         session->request = RT_NULL;
     }
+    _webnet_session_arena_reset(session);
+    if (session->arena != RT_NULL)
+        wn_free(session->arena);
+
+#ifdef WEBNET_USING_KEEPALIVE
+    if (session->pipeline_buffer != RT_NULL)
+        wn_free(session->pipeline_buffer);
+#endif
 
     wn_free(session);
 }
@@ -203,9 +327,7 @@ int webnet_session_redirect(struct webnet_session *session, const char* url)
     RT_ASSERT(request != RT_NULL);
 
     /* change the request path to URL */
-    if (request->path != RT_NULL)
-        wn_free(request->path);
-    request->path = wn_strdup(url);
+    request->path = webnet_session_strdup(session, url);
 
     /* handle this URL */
     return webnet_module_handle_uri(session);
@@ -304,6 +426,9 @@ void webnet_session_set_header(struct webnet_session *session, const char* mimet
     }
     else
     {
+        /* the end of content is the end of connection */
+        session->request->connection = WEBNET_CONN_CLOSE;
+
         offset = rt_snprintf(ptr, end_buffer - ptr, content_nolength, mimetype, "close");
         ptr += offset;
     }
@@ -319,16 +444,10 @@ void webnet_session_set_header(struct webnet_session *session, const char* mimet
 }
 RTM_EXPORT(webnet_session_set_header);
 
-static void _webnet_session_handle_read(struct webnet_session* session)
+static void _webnet_session_parse(struct webnet_session* session)
 {
-    int read_length;
-    rt_uint8_t *buffer_ptr;
-
-    buffer_ptr = &session->buffer[session->buffer_offset];
-    /* to read data from the socket */
-    read_length = webnet_session_read(session, (char*)buffer_ptr, session->buffer_length - session->buffer_offset);
-
-    if (read_length > 0) session->buffer_offset += read_length;
+    /* terminate the buffered data for string parsing */
+    session->buffer[session->buffer_offset] = '\0';
 
     if (session->buffer_offset)
     {
@@ -338,6 +457,13 @@ static void _webnet_session_handle_read(struct webnet_session* session)
             int length = webnet_request_parse_method(session->request, (char*)&session->buffer[0],
                 session->buffer_offset);
 
+            /* bad or not implemented request */
+            if (session->request->result_code != 200)
+            {
+                session->session_phase = WEB_PHASE_CLOSE;
+                return;
+            }
+
             if (length)
             {
                 if (length < session->buffer_offset)
@@ -387,10 +513,81 @@ static void _webnet_session_handle_read(struct webnet_session* session)
     }
 }
 
+static void _webnet_session_handle_read(struct webnet_session* session)
+{
+    int read_length;
+    rt_uint8_t *buffer_ptr;
+
+    buffer_ptr = &session->buffer[session->buffer_offset];
+    /* to read data from the socket, reserve one byte for the terminal character */
+    read_length = webnet_session_read(session, (char*)buffer_ptr, session->buffer_length - session->buffer_offset - 1);
+
+    if (read_length > 0) session->buffer_offset += read_length;
+
+    _webnet_session_parse(session);
+}
+
 static void _webnet_session_handle_write(struct webnet_session* session)
 {
 }
 
+#ifdef WEBNET_USING_KEEPALIVE
+/**
+ * decide whether the session is kept alive after this request, and save
+ * the pipelined requests because the session buffer is reused by response.
+ */
+static void _webnet_session_keepalive_prepare(struct webnet_session* session)
+{
+    struct webnet_request *request = session->request;
+
+    session->request_count ++;
+
+    /* request body is not consumed by parser (such as multipart upload) or too many requests */
+    if (request->content_length != request->query_offset ||
+            session->request_count >= WEBNET_KEEPALIVE_MAX)
+    {
+        request->connection = WEBNET_CONN_CLOSE;
+    }
+
+    /* responses go out as several writes, on a connection that stays open the last one
+       must not wait for the delayed ack of the previous one. A closing connection flushes
+       with the FIN and keeps Nagle. */
+    if (request->connection == WEBNET_CONN_KEEPALIVE && session->request_count == 1)
+    {
+        int nodelay = 1;
+        setsockopt(session->socket, IPPROTO_TCP, TCP_NODELAY, (void *) &nodelay, sizeof(nodelay));
+    }
+
+    if (request->connection == WEBNET_CONN_KEEPALIVE && session->buffer_offset > 0)
+    {
+        session->pipeline_buffer = (rt_uint8_t *)wn_malloc(session->buffer_offset);
+        if (session->pipeline_buffer == RT_NULL)
+        {
+            request->connection = WEBNET_CONN_CLOSE;
+            return;
+        }
+
+        rt_memcpy(session->pipeline_buffer, session->buffer, session->buffer_offset);
+        session->pipeline_length = session->buffer_offset;
+        session->buffer_offset = 0;
+    }
+}
+#endif /* WEBNET_USING_KEEPALIVE */
+
+static void _webnet_session_response(struct webnet_session* session)
+{
+#ifdef WEBNET_USING_KEEPALIVE
+    _webnet_session_keepalive_prepare(session);
+#endif
+
+    /* remove the default session ops */
+    session->session_ops = NULL;
+    session->user_data = 0;
+
+    /* to handle response, then let module to handle url */
+    webnet_module_handle_uri(session);
+}
+
 static void _webnet_session_handle(struct webnet_session* session, int event)
 {
     switch (event)
@@ -401,12 +598,7 @@ static void _webnet_session_handle(struct webnet_session* session, int event)
         /* in the response phase */
         if (session->session_phase == WEB_PHASE_RESPONSE)
         {
-            /* remove the default session ops */
-            session->session_ops = NULL;
-            session->user_data = 0;
-
-            /* to handle response, then let module to handle url */
-            webnet_module_handle_uri(session);
+            _webnet_session_response(session);
         }
         break;
 
@@ -469,6 +661,134 @@ static void _webnet_session_badrequest(struct webnet_session *session, int code)
     webnet_session_printf(session, fmt, code, title, code, title);
 }
 
+static void _webnet_session_report_error(struct webnet_session *session)
+{
+    /* check result code */
+    if (session->request == RT_NULL || session->request->result_code == 200)
+        return;
+
+    /* do request err callback */
+    if (webnet_err_callback != RT_NULL)
+    {
+        webnet_err_callback(session);
+    }
+    else
+    {
+        _webnet_session_badrequest(session, session->request->result_code);
+    }
+
+#ifdef WEBNET_USING_KEEPALIVE
+    session->request->connection = WEBNET_CONN_CLOSE;
+#endif
+}
+
+static int _webnet_session_request_begin(struct webnet_session *session)
+{
+    struct webnet_request *request;
+
+    /* destroy old request */
+    if (session->request != RT_NULL)
+    {
+        webnet_request_destory(session->request);
+        session->request = RT_NULL;
+    }
+    _webnet_session_arena_reset(session);
+
+    /* create request and use the default session ops */
+    request = webnet_request_create();
+    if (request == RT_NULL)
+    {
+        return -1;
+    }
+
+    session->request = request;
+    session->session_phase = WEB_PHASE_METHOD;
+    /* set the default session ops */
+    session->session_ops = &_default_session_ops;
+    session->user_data = RT_NULL;
+
+    request->session = session;
+    request->result_code = 200; /* set the default result code to 200 */
+
+    return 0;
+}
+
+#ifdef WEBNET_USING_KEEPALIVE
+/**
+ * reset a keep-alive session to wait for the next request
+ */
+static void _webnet_session_reset(struct webnet_session *session)
+{
+    /* invoke session close */
+    if (session->session_ops != RT_NULL &&
+            session->session_ops->session_close != RT_NULL)
+    {
+        session->session_ops->session_close(session);
+    }
+
+    session->session_ops = RT_NULL;
+    session->session_event_mask = 0;
+    session->session_phase = WEB_PHASE_METHOD;
+    session->user_data = 0;
+
+    if (session->request != RT_NULL)
+    {
+        webnet_request_destory(session->request);
+        session->request = RT_NULL;
+    }
+    _webnet_session_arena_reset(session);
+
+    /* restore the pipelined requests */
+    session->buffer_offset = 0;
+    if (session->pipeline_buffer != RT_NULL)
+    {
+        rt_memcpy(session->buffer, session->pipeline_buffer, session->pipeline_length);
+        session->buffer_offset = session->pipeline_length;
+
+        wn_free(session->pipeline_buffer);
+        session->pipeline_buffer = RT_NULL;
+        session->pipeline_length = 0;
+    }
+
+    session->idle_tick = rt_tick_get();
+}
+#endif /* WEBNET_USING_KEEPALIVE */
+
+/**
+ * end the request of a session. The keep-alive session continues to handle
+ * the pipelined requests in the session buffer, others are closed.
+ */
+static void _webnet_session_request_end(struct webnet_session *session)
+{
+#ifdef WEBNET_USING_KEEPALIVE
+    while (session->request != RT_NULL &&
+            session->request->connection == WEBNET_CONN_KEEPALIVE)
+    {
+        _webnet_session_reset(session);
+
+        /* no pipelined request, wait for the next request */
+        if (session->buffer_offset == 0) return;
+
+        if (_webnet_session_request_begin(session) != 0) break;
+
+        _webnet_session_parse(session);
+        if (session->session_phase == WEB_PHASE_RESPONSE)
+        {
+            _webnet_session_response(session);
+        }
+
+        /* request is not complete or response is in progress */
+        if (session->session_ops != RT_NULL && session->session_phase != WEB_PHASE_CLOSE)
+            return;
+
+        _webnet_session_report_error(session);
+    }
+#endif /* WEBNET_USING_KEEPALIVE */
+
+    /* close this session */
+    webnet_session_close(session);
+}
+
 /**
  * set the file descriptors
  *
@@ -487,9 +807,11 @@ int webnet_sessions_set_fds(fd_set *readset, fd_set *writeset)
         if (maxfdp1 < session->socket + 1)
             maxfdp1 = session->socket + 1;
 
-        FD_SET(session->socket, readset);
+        /* the (pipelined) request data is not read until the response is sent */
         if (session->session_event_mask & WEBNET_EVENT_WRITE)
             FD_SET(session->socket, writeset);
+        else
+            FD_SET(session->socket, readset);
     }
 
     return maxfdp1;
@@ -520,28 +842,8 @@ void webnet_sessions_handle_fds(fd_set *readset, fd_set *writeset)
         {
             if (session->session_ops == RT_NULL)
             {
-                struct webnet_request *request;
-
-                /* destroy old request */
-                if (session->request != RT_NULL)
+                if (_webnet_session_request_begin(session) == 0)
                 {
-                    webnet_request_destory(session->request);
-                    session->request = RT_NULL;
-                }
-
-                /* create request and use the default session ops */
-                request = webnet_request_create();
-                if (request)
-                {
-                    session->request = request;
-                    session->session_phase = WEB_PHASE_METHOD;
-                    /* set the default session ops */
-                    session->session_ops = &_default_session_ops;
-                    session->user_data = RT_NULL;
-
-                    request->session = session;
-                    request->result_code = 200; /* set the default result code to 200 */
-
                     /* handle read event */
                     session->session_ops->session_handle(session, WEBNET_EVENT_READ);
                 }
@@ -557,24 +859,11 @@ void webnet_sessions_handle_fds(fd_set *readset, fd_set *writeset)
                     session->session_ops->session_handle(session, WEBNET_EVENT_READ);
             }
 
-            /* whether close this session */
+            /* whether end the request of this session */
             if (session->session_ops == RT_NULL || session->session_phase == WEB_PHASE_CLOSE)
             {
-                /* check result code */
-                if (session->request->result_code != 200)
-                {
-                    /* do request err callback */
-                    if (webnet_err_callback != RT_NULL)
-                    {
-                        webnet_err_callback(session);
-                    }
-                    else
-                    {
-                        _webnet_session_badrequest(session, session->request->result_code);
-                    }
-                }
-                /* close this session */
-                webnet_session_close(session);
+                _webnet_session_report_error(session);
+                _webnet_session_request_end(session);
             }
         }
         else if (FD_ISSET(session->socket, writeset))
@@ -586,16 +875,37 @@ void webnet_sessions_handle_fds(fd_set *readset, fd_set *writeset)
                 session->session_ops->session_handle(session, WEBNET_EVENT_WRITE);
             }
 
-            /* whether close this session */
+            /* whether end the request of this session */
             if (session->session_ops == RT_NULL || session->session_phase == WEB_PHASE_CLOSE)
             {
-                /* close this session */
-                webnet_session_close(session);
+                _webnet_session_request_end(session);
             }
         }
     }
 }
 
+#ifdef WEBNET_USING_KEEPALIVE
+/**
+ * close the sessions which wait for next request too long
+ */
+void webnet_sessions_handle_idle(void)
+{
+    struct webnet_session *session, *next_session;
+    rt_tick_t timeout = rt_tick_from_millisecond(WEBNET_KEEPALIVE_TIMEOUT * 1000);
+
+    for (session = _session_list; session; session = next_session)
+    {
+        next_session = session->next;
+
+        if (session->session_ops == RT_NULL &&
+                (rt_tick_get() - session->idle_tick) >= timeout)
+        {
+            webnet_session_close(session);
+        }
+    }
+}
+#endif /* WEBNET_USING_KEEPALIVE */
+
 #ifdef RT_USING_FINSH
 #include <finsh.h>
 
@@ -621,6 +931,17 @@ static void list_webnet(void)
             rt_kprintf("path: %s\n", session->request->path);
         }
 
+        {
+            struct webnet_arena_chunk *chunk;
+            rt_uint32_t chunk_num = 0;
+
+            for (chunk = session->arena_chunk; chunk != RT_NULL; chunk = chunk->next)
+                chunk_num ++;
+            rt_kprintf("arena: %d/%d bytes, %d overflow chunk\n",
+                       session->arena != RT_NULL ? session->arena->offset : 0,
+                       session->arena != RT_NULL ? WEBNET_ARENA_SIZE : 0, chunk_num);
+        }
+
         rt_kprintf("\r\n");
     }
     rt_exit_critical();
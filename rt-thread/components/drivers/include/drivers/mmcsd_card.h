@@ -152,6 +152,9 @@ struct rt_mmcsd_card {
 #define CARD_FLAG_HIGHSPEED  (1 << 0)   /* SDIO bus speed 50MHz */
 #define CARD_FLAG_SDHC       (1 << 1)   /* SDHC card */
 #define CARD_FLAG_SDXC       (1 << 2)   /* SDXC card */
+#define CARD_FLAG_1V8        (1 << 3)   /* UHS-I card switched to 1.8V signalling */
+#define CARD_FLAG_SDR50      (1 << 4)   /* UHS-I SDR50, 100MHz */
+#define CARD_FLAG_SDR104     (1 << 5)   /* UHS-I SDR104, 208MHz */
 
     struct rt_sd_scr    scr;
     struct rt_mmcsd_csd csd;
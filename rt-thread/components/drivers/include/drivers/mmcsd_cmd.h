@@ -75,6 +75,10 @@ extern "C" {
 /* This is basically the same command as for MMC with some quirks. */
 #define SD_SEND_RELATIVE_ADDR     3   /* bcr                     R6  */
 #define SD_SEND_IF_COND           8   /* bcr  [11:0] See below   R7  */
+#define SD_SWITCH_VOLTAGE        11   /* ac                      R1  */
+
+  /* class 2 */
+#define SD_SEND_TUNING_BLOCK     19   /* adtc                    R1  */
 
   /* class 10 */
 #define SD_SWITCH                 6   /* adtc [31:0] See below   R1  */
@@ -85,6 +89,14 @@ extern "C" {
 #define SD_APP_OP_COND           41   /* bcr  [31:0] OCR         R3  */
 #define SD_APP_SEND_SCR          51   /* adtc                    R1  */
 
+/* SD_APP_OP_COND argument and response */
+#define SD_OCR_S18R         (1 << 24)   /* 1.8V switching request / accepted */
+
+/* SD_SWITCH bus speed functions, group 1 */
+#define SD_SWITCH_FUNC_HS       1
+#define SD_SWITCH_FUNC_SDR50    2
+#define SD_SWITCH_FUNC_SDR104   3
+
 #define SCR_SPEC_VER_0      0   /* Implements system specification 1.0 - 1.01 */
 #define SCR_SPEC_VER_1      1   /* Implements system specification 1.10 */
 #define SCR_SPEC_VER_2      2   /* Implements system specification 2.00 */
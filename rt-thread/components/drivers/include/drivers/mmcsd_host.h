@@ -46,6 +46,18 @@ struct rt_mmcsd_io_cfg {
 #define MMCSD_BUS_WIDTH_4       2
 #define MMCSD_BUS_WIDTH_8       3
 
+    rt_uint8_t  timing;         /* bus speed mode */
+
+#define MMCSD_TIMING_LEGACY     0
+#define MMCSD_TIMING_SD_HS      1
+#define MMCSD_TIMING_UHS_SDR50  2
+#define MMCSD_TIMING_UHS_SDR104 3
+
+    rt_uint8_t  signal_voltage; /* i/o signalling level */
+
+#define MMCSD_SIGNAL_VOLTAGE_330    0
+#define MMCSD_SIGNAL_VOLTAGE_180    1
+
 };
 
 struct rt_mmcsd_host;
@@ -56,6 +68,8 @@ struct rt_mmcsd_host_ops {
     void (*set_iocfg)(struct rt_mmcsd_host *host, struct rt_mmcsd_io_cfg *io_cfg);
     rt_int32_t (*get_card_status)(struct rt_mmcsd_host *host);
     void (*enable_sdio_irq)(struct rt_mmcsd_host *host, rt_int32_t en);
+    rt_int32_t (*execute_tuning)(struct rt_mmcsd_host *host, rt_int32_t opcode);
+    rt_int32_t (*switch_uhs_voltage)(struct rt_mmcsd_host *host); /* after CMD11, 3.3 V -> 1.8 V */
 };
 
 struct rt_mmcsd_host {
@@ -90,6 +104,9 @@ struct rt_mmcsd_host {
 #define controller_is_spi(host) (host->flags & MMCSD_HOST_IS_SPI)
 #define MMCSD_SUP_SDIO_IRQ  (1 << 4)    /* support signal pending SDIO IRQs */
 #define MMCSD_SUP_HIGHSPEED (1 << 5)    /* support high speed */
+#define MMCSD_SUP_SDR50     (1 << 6)    /* support UHS-I SDR50, 1.8 V signalling */
+#define MMCSD_SUP_SDR104    (1 << 7)    /* support UHS-I SDR104, 1.8 V signalling */
+#define MMCSD_SUP_UHS       (MMCSD_SUP_SDR50 | MMCSD_SUP_SDR104)
 
     rt_uint32_t max_seg_size;   /* maximum size of one dma segment */
     rt_uint32_t max_dma_segs;   /* maximum number of dma segments in one request */
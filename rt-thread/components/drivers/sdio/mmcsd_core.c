@@ -437,6 +437,24 @@ void mmcsd_set_bus_width(struct rt_mmcsd_host *host, rt_uint32_t width)
     mmcsd_set_iocfg(host);
 }
 
+/*
+ * Change the bus speed mode of a host.
+ */
+void mmcsd_set_timing(struct rt_mmcsd_host *host, rt_uint32_t timing)
+{
+    host->io_cfg.timing = timing;
+    mmcsd_set_iocfg(host);
+}
+
+/*
+ * Change the i/o signalling level of a host, the card has to be there already.
+ */
+void mmcsd_set_signal_voltage(struct rt_mmcsd_host *host, rt_uint32_t voltage)
+{
+    host->io_cfg.signal_voltage = voltage;
+    mmcsd_set_iocfg(host);
+}
+
 void mmcsd_set_data_timeout(struct rt_mmcsd_data       *data,
                             const struct rt_mmcsd_card *card)
 {
@@ -557,6 +575,8 @@ static void mmcsd_power_up(struct rt_mmcsd_host *host)
     }
     host->io_cfg.power_mode = MMCSD_POWER_UP;
     host->io_cfg.bus_width = MMCSD_BUS_WIDTH_1;
+    host->io_cfg.timing = MMCSD_TIMING_LEGACY;
+    host->io_cfg.signal_voltage = MMCSD_SIGNAL_VOLTAGE_330;
     mmcsd_set_iocfg(host);
 
     /*
@@ -587,6 +607,8 @@ static void mmcsd_power_off(struct rt_mmcsd_host *host)
     }
     host->io_cfg.power_mode = MMCSD_POWER_OFF;
     host->io_cfg.bus_width = MMCSD_BUS_WIDTH_1;
+    host->io_cfg.timing = MMCSD_TIMING_LEGACY;
+    host->io_cfg.signal_voltage = MMCSD_SIGNAL_VOLTAGE_330;
     mmcsd_set_iocfg(host);
 }
 
@@ -155,6 +155,7 @@ static rt_int32_t mmcsd_switch(struct rt_mmcsd_card *card)
     struct rt_mmcsd_cmd cmd;
     struct rt_mmcsd_data data;
     rt_uint8_t *buf;
+    rt_uint32_t func = SD_SWITCH_FUNC_HS;
 
     buf = (rt_uint8_t*)rt_malloc(64);
     if (!buf)
@@ -199,10 +200,31 @@ static rt_int32_t mmcsd_switch(struct rt_mmcsd_card *card)
     if (buf[13] & 0x02)
         card->hs_max_data_rate = 50000000;
 
+    /*
+     * SDR50/SDR104 are only offered at 1.8V, a card that did not answer S18A
+     * was left there by a warm reset without power cycle, follow it.
+     */
+    if (!(card->flags & CARD_FLAG_1V8) && (host->flags & MMCSD_SUP_UHS) &&
+        (buf[13] & ((1 << SD_SWITCH_FUNC_SDR50) | (1 << SD_SWITCH_FUNC_SDR104))))
+    {
+        LOG_I("card is still on 1.8V signalling.");
+        mmcsd_set_signal_voltage(host, MMCSD_SIGNAL_VOLTAGE_180);
+        card->flags |= CARD_FLAG_1V8;
+    }
+
+    /* bus speed group, a UHS-I mode needs the card on 1.8V signalling */
+    if (card->flags & CARD_FLAG_1V8)
+    {
+        if ((host->flags & MMCSD_SUP_SDR104) && (buf[13] & (1 << SD_SWITCH_FUNC_SDR104)))
+            func = SD_SWITCH_FUNC_SDR104;
+        else if ((host->flags & MMCSD_SUP_SDR50) && (buf[13] & (1 << SD_SWITCH_FUNC_SDR50)))
+            func = SD_SWITCH_FUNC_SDR50;
+    }
+
     rt_memset(&cmd, 0, sizeof(struct rt_mmcsd_cmd));
 
     cmd.cmd_code = SD_SWITCH;
-    cmd.arg = 0x80FFFFF1;
+    cmd.arg = 0x80FFFFF0 | func;
     cmd.flags = RESP_R1 | CMD_ADTC;
 
     rt_memset(&data, 0, sizeof(struct rt_mmcsd_data));
@@ -226,13 +248,26 @@ static rt_int32_t mmcsd_switch(struct rt_mmcsd_card *card)
         goto err1;
     }
 
-    if ((buf[16] & 0xF) != 1)
+    if ((buf[16] & 0xF) != func)
     {
-        LOG_I("switching card to high speed failed!");
+        LOG_I("switching card to bus speed function %d failed!", func);
         goto err;
     }
 
-    card->flags |= CARD_FLAG_HIGHSPEED;
+    switch (func)
+    {
+    case SD_SWITCH_FUNC_SDR104:
+        card->flags |= CARD_FLAG_SDR104;
+        card->hs_max_data_rate = 208000000;
+        break;
+    case SD_SWITCH_FUNC_SDR50:
+        card->flags |= CARD_FLAG_SDR50;
+        card->hs_max_data_rate = 100000000;
+        break;
+    default:
+        card->flags |= CARD_FLAG_HIGHSPEED;
+        break;
+    }
 
 err:
     rt_free(buf);
@@ -469,6 +504,33 @@ rt_err_t mmcsd_get_card_addr(struct rt_mmcsd_host *host, rt_uint32_t *rca)
     (((rt_uint32_t)(x) & (rt_uint32_t)0x00ff0000UL) >>  8) |        \
     (((rt_uint32_t)(x) & (rt_uint32_t)0xff000000UL) >> 24)))
 
+/*
+ * CMD11, then the host moves its i/o to 1.8V while the card does the same.
+ * The card has to be power cycled if this fails after CMD11 was accepted.
+ */
+static rt_err_t mmcsd_sd_switch_voltage(struct rt_mmcsd_host *host)
+{
+    struct rt_mmcsd_cmd cmd;
+    rt_err_t err;
+
+    rt_memset(&cmd, 0, sizeof(struct rt_mmcsd_cmd));
+
+    cmd.cmd_code = SD_SWITCH_VOLTAGE;
+    cmd.arg = 0;
+    cmd.flags = RESP_R1 | CMD_AC;
+
+    err = mmcsd_send_cmd(host, &cmd, 0);
+    if (err)
+        return err;
+
+    host->io_cfg.signal_voltage = MMCSD_SIGNAL_VOLTAGE_180;
+    err = host->ops->switch_uhs_voltage(host);
+    if (err)
+        host->io_cfg.signal_voltage = MMCSD_SIGNAL_VOLTAGE_330;
+
+    return err;
+}
+
 rt_int32_t mmcsd_get_scr(struct rt_mmcsd_card *card, rt_uint32_t *scr)
 {
     rt_int32_t err;
@@ -519,6 +581,9 @@ static rt_int32_t mmcsd_sd_init_card(struct rt_mmcsd_host *host,
     rt_int32_t err;
     rt_uint32_t resp[4];
     rt_uint32_t max_data_rate;
+    rt_uint32_t rocr = 0;
+    rt_bool_t uhs = (host->flags & MMCSD_SUP_UHS) && (host->ops->switch_uhs_voltage != RT_NULL);
+    rt_bool_t signal_1v8 = RT_FALSE;
 
     mmcsd_go_idle(host);
 
@@ -530,12 +595,30 @@ static rt_int32_t mmcsd_sd_init_card(struct rt_mmcsd_host *host,
      */
     err = mmcsd_send_if_cond(host, ocr);
     if (!err)
+    {
         ocr |= 1 << 30;
+        /* S18R, ask for 1.8V signalling */
+        if (uhs)
+            ocr |= SD_OCR_S18R;
+    }
 
-    err = mmcsd_send_app_op_cond(host, ocr, RT_NULL);
+    err = mmcsd_send_app_op_cond(host, ocr, &rocr);
     if (err)
         goto err;
 
+    /* S18A, the card can switch now, before CMD2 takes it out of the ready state */
+    if ((ocr & SD_OCR_S18R) && (rocr & SD_OCR_S18R))
+    {
+        err = mmcsd_sd_switch_voltage(host);
+        if (err)
+        {
+            /* the card is somewhere between 3.3V and 1.8V now, only a power cycle brings it back */
+            LOG_E("switching to 1.8V signalling failed, the card needs a power cycle!");
+            goto err;
+        }
+        signal_1v8 = RT_TRUE;
+    }
+
     if (controller_is_spi(host))
         err = mmcsd_get_cid(host, resp);
     else
@@ -554,6 +637,8 @@ static rt_int32_t mmcsd_sd_init_card(struct rt_mmcsd_host *host,
 
     card->card_type = CARD_TYPE_SD;
     card->host = host;
+    if (signal_1v8)
+        card->flags |= CARD_FLAG_1V8;
     rt_memcpy(card->resp_cid, resp, sizeof(card->resp_cid));
 
     /*
@@ -596,8 +681,19 @@ static rt_int32_t mmcsd_sd_init_card(struct rt_mmcsd_host *host,
             goto err1;
     }
 
+    /*switch bus width, before the bus speed so a UHS-I mode is tuned on 4 bits*/
+    if ((host->flags & MMCSD_BUSWIDTH_4) &&
+        (card->scr.sd_bus_widths & SD_SCR_BUS_WIDTH_4))
+    {
+        err = mmcsd_app_set_bus_width(card, MMCSD_BUS_WIDTH_4);
+        if (err)
+            goto err1;
+
+        mmcsd_set_bus_width(host, MMCSD_BUS_WIDTH_4);
+    }
+
     /*
-     * change SD card to high-speed, only SD2.0 spec
+     * change SD card to high-speed, only SD2.0 spec, or to a UHS-I mode
      */
     err = mmcsd_switch(card);
     if (err)
@@ -606,7 +702,7 @@ static rt_int32_t mmcsd_sd_init_card(struct rt_mmcsd_host *host,
     /* set bus speed */
     max_data_rate = (unsigned int)-1;
 
-    if (card->flags & CARD_FLAG_HIGHSPEED)
+    if (card->flags & (CARD_FLAG_HIGHSPEED | CARD_FLAG_SDR50 | CARD_FLAG_SDR104))
     {
         if (max_data_rate > card->hs_max_data_rate)
             max_data_rate = card->hs_max_data_rate;
@@ -616,17 +712,24 @@ static rt_int32_t mmcsd_sd_init_card(struct rt_mmcsd_host *host,
         max_data_rate = card->max_data_rate;
     }
 
+    if (card->flags & CARD_FLAG_SDR104)
+        mmcsd_set_timing(host, MMCSD_TIMING_UHS_SDR104);
+    else if (card->flags & CARD_FLAG_SDR50)
+        mmcsd_set_timing(host, MMCSD_TIMING_UHS_SDR50);
+    else if (card->flags & CARD_FLAG_HIGHSPEED)
+        mmcsd_set_timing(host, MMCSD_TIMING_SD_HS);
+
     mmcsd_set_clock(host, max_data_rate);
 
-    /*switch bus width*/
-    if ((host->flags & MMCSD_BUSWIDTH_4) &&
-        (card->scr.sd_bus_widths & SD_SCR_BUS_WIDTH_4))
+    /* the host finds its sampling point with CMD19, it may skip it for SDR50 */
+    if ((card->flags & (CARD_FLAG_SDR50 | CARD_FLAG_SDR104)) && (host->ops->execute_tuning != RT_NULL))
     {
-        err = mmcsd_app_set_bus_width(card, MMCSD_BUS_WIDTH_4);
+        err = host->ops->execute_tuning(host, SD_SEND_TUNING_BLOCK);
         if (err)
-            goto err1;
-
-        mmcsd_set_bus_width(host, MMCSD_BUS_WIDTH_4);
+        {
+            LOG_W("tuning failed, keep the card at 50MHz!");
+            mmcsd_set_clock(host, 50000000);
+        }
     }
 
     host->card = card;
@@ -310,6 +310,14 @@
    link level header. */
 #define PBUF_LINK_HLEN              16
 
+/* network drivers pass their dma buffers up as custom pbufs */
+#define LWIP_SUPPORT_CUSTOM_PBUF    1
+
+#ifdef RT_WLAN_PROT_LWIP_PBUF_FORCE
+/* wlan drivers get the pbufs themselves: room for a driver header in front of tx frames */
+#define PBUF_LINK_ENCAPSULATION_HLEN 12
+#endif
+
 #ifdef RT_LWIP_ETH_PAD_SIZE
 #define ETH_PAD_SIZE                RT_LWIP_ETH_PAD_SIZE
 #endif
@@ -401,6 +409,9 @@
 #define CHECKSUM_CHECK_UDP              0
 #define CHECKSUM_CHECK_TCP              0
 #define CHECKSUM_CHECK_ICMP             0
+#elif defined(BSP_ETH_USING_HW_CHECKSUM)
+/* only the ENET netifs offload checksums, the wlan netifs keep the software path */
+#define LWIP_CHECKSUM_CTRL_PER_NETIF    1
 #endif
 
 /* ---------- IP options ---------- */
@@ -109,6 +109,7 @@
 #define RT_SYSTEM_WORKQUEUE_PRIORITY 23
 #define RT_USING_SERIAL
 #define RT_USING_SERIAL_V2
+#define RT_USING_PHY
 #define RT_USING_PIN
 #define RT_USING_RTC
 #define RT_USING_SOFT_RTC
@@ -140,6 +141,7 @@
 #define RT_WLAN_DEFAULT_PROT "lwip"
 #define RT_WLAN_PROT_LWIP_ENABLE
 #define RT_WLAN_PROT_LWIP_NAME "lwip"
+#define RT_WLAN_PROT_LWIP_PBUF_FORCE
 #define RT_WLAN_WORK_THREAD_ENABLE
 #define RT_WLAN_WORKQUEUE_THREAD_NAME "wlan"
 #define RT_WLAN_WORKQUEUE_THREAD_SIZE 2048
@@ -258,6 +260,7 @@
 
 #define WEBNET_USING_CGI
 #define WEBNET_USING_UPLOAD
+#define WEBNET_USING_KEEPALIVE
 #define WEBNET_CACHE_LEVEL 0
 /* end of Select supported modules */
 #define PKG_USING_WEBNET_V203
@@ -384,6 +387,7 @@
 
 /* On-chip Peripheral Drivers */
 
+#define BSP_DMA_POOL_SIZE 1048576
 #define BSP_USING_GPIO
 #define BSP_USING_UART
 #define BSP_USING_UART0
@@ -394,6 +398,12 @@
 #define BSP_UART6_TX_BUFSIZE 0
 #define BSP_USING_SPI
 #define BSP_USING_SPI1
+#define BSP_SPI1_USING_DMA
+#define BSP_SPI1_RX_DMA_CHANNEL 2
+#define BSP_SPI1_TX_DMA_CHANNEL 3
+#define BSP_USING_ETH
+#define BSP_USING_ETH1
+#define BSP_ETH_USING_HW_CHECKSUM
 #define BSP_USING_SDXC
 #define BSP_USING_SDXC1
 #define BSP_USING_DRAM
@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+Static file server with HTTP Range support, for testing the http_ota client.
+
+python's http.server ignores the Range header, this one answers
+"Range: bytes=start-end" with 206 Partial Content.
+
+usage: range_server.py [-p PORT] [-d DIR]
+then on the device: http_ota http://<host ip>:<port>/rtthread.rbl
+"""
+
+import argparse
+import functools
+import os
+import re
+from http.server import SimpleHTTPRequestHandler, ThreadingHTTPServer
+
+
+class RangeHandler(SimpleHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+
+    def send_head(self):
+        path = self.translate_path(self.path)
+        match = re.match(r"bytes=(\d+)-(\d*)$", self.headers.get("Range", ""))
+        if not os.path.isfile(path) or not match:
+            return super().send_head()
+
+        size = os.path.getsize(path)
+        start = int(match.group(1))
+        end = int(match.group(2)) if match.group(2) else size - 1
+        end = min(end, size - 1)
+        if start > end:
+            self.send_error(416)
+            return None
+
+        f = open(path, "rb")
+        f.seek(start)
+        self.range_left = end - start + 1
+        self.send_response(206)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Range", "bytes %d-%d/%d" % (start, end, size))
+        self.send_header("Content-Length", str(self.range_left))
+        self.end_headers()
+        return f
+
+    def copyfile(self, source, outputfile):
+        left = getattr(self, "range_left", None)
+        if left is None:
+            return super().copyfile(source, outputfile)
+        while left > 0:
+            data = source.read(min(left, 64 * 1024))
+            if not data:
+                break
+            outputfile.write(data)
+            left -= len(data)
+        self.range_left = None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="http server with range support")
+    parser.add_argument("-p", "--port", type=int, default=8000)
+    parser.add_argument("-d", "--directory", default=os.getcwd())
+    args = parser.parse_args()
+
+    handler = functools.partial(RangeHandler, directory=args.directory)
+    server = ThreadingHTTPServer(("", args.port), handler)
+    print("serving %s on port %d" % (args.directory, args.port))
+    server.serve_forever()
+
+
+if __name__ == "__main__":
+    main()
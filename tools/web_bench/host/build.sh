@@ -0,0 +1,12 @@
+#!/bin/sh
+# Build the webnet package for the host, see main.c.
+#
+# usage: build.sh [webnet source dir] [output]
+set -e
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+WEBNET=${1:-$HERE/../../../packages/webnet-v2.0.3}
+OUT=${2:-$HERE/webnet_host}
+
+${CC:-cc} -O2 -w -D_GNU_SOURCE -include "$HERE/inc/rtconfig.h" -I"$HERE/inc" -I"$WEBNET/inc" \
+    "$WEBNET"/src/*.c "$WEBNET"/module/wn_module_cgi.c "$HERE/main.c" -lpthread -o "$OUT"
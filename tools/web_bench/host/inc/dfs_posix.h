@@ -0,0 +1,5 @@
+/* dfs posix file API, libc provides it on the host */
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <dirent.h>
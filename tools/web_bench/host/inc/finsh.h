@@ -0,0 +1,3 @@
+/* finsh commands are not built on the host */
+#define MSH_CMD_EXPORT(a, b)
+#define FINSH_FUNCTION_EXPORT(a, b)
@@ -0,0 +1,11 @@
+/* webnet options of the host build, the ones this BSP turns on in rtconfig.h */
+#define PKG_USING_WEBNET
+#define WEBNET_PORT 80
+#define WEBNET_CONN_MAX 16
+#define WEBNET_ROOT "www"
+#define WEBNET_USING_CGI
+#define WEBNET_USING_KEEPALIVE
+#define WEBNET_CACHE_LEVEL 0
+#define SAL_USING_POSIX
+#define RT_USING_DFS
+#define RT_USING_SAL
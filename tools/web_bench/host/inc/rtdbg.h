@@ -0,0 +1,5 @@
+/* rtdbg.h levels, printed to stdout */
+#define LOG_E(...) do { printf("[E] " __VA_ARGS__); printf("\n"); } while (0)
+#define LOG_W(...) do { printf("[W] " __VA_ARGS__); printf("\n"); } while (0)
+#define LOG_I(...) do { printf("[I] " __VA_ARGS__); printf("\n"); } while (0)
+#define LOG_D(...)
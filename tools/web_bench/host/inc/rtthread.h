@@ -0,0 +1,62 @@
+/* the parts of rtthread.h webnet uses, mapped to libc and pthreads */
+#ifndef HOST_RTTHREAD_H
+#define HOST_RTTHREAD_H
+#include "rtconfig.h"
+#include <stdio.h>
+#include <stdarg.h>
+#define RTM_EXPORT(x)
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <assert.h>
+#include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+typedef uint8_t rt_uint8_t; typedef uint16_t rt_uint16_t; typedef uint32_t rt_uint32_t;
+typedef int8_t rt_int8_t; typedef int16_t rt_int16_t; typedef int32_t rt_int32_t;
+typedef size_t rt_size_t; typedef unsigned long rt_ubase_t; typedef long rt_base_t;
+typedef int rt_bool_t; typedef long rt_err_t; typedef uint32_t rt_tick_t; typedef long rt_off_t;
+typedef struct { int dummy; } *rt_thread_t;
+#define RT_NULL NULL
+#define RT_TRUE 1
+#define RT_FALSE 0
+#define RT_EOK 0
+#define RT_ERROR 1
+#define RT_ENOMEM 5
+#define RT_TICK_PER_SECOND 1000
+#define RT_ALIGN_SIZE 4
+#define RT_ALIGN(size, align) (((size) + (align) - 1) & ~((align) - 1))
+#define RT_ALIGN_DOWN(size, align) ((size) & ~((align) - 1))
+#define RT_ASSERT(x) assert(x)
+#define rt_inline static inline
+#define rt_malloc malloc
+#define rt_free free
+#define rt_realloc realloc
+#define rt_calloc calloc
+#define rt_strdup strdup
+#define rt_memcpy memcpy
+#define rt_memmove memmove
+#define rt_memset memset
+#define rt_memcmp memcmp
+#define rt_strlen strlen
+#define rt_strncpy strncpy
+#define rt_strcmp strcmp
+#define rt_strncmp strncmp
+#define rt_strstr strstr
+#define rt_snprintf snprintf
+#define rt_sprintf sprintf
+#define rt_kprintf printf
+#define rt_enter_critical()
+#define rt_exit_critical()
+#define closesocket close
+static inline rt_tick_t rt_tick_get(void) { struct timespec ts; clock_gettime(CLOCK_MONOTONIC, &ts); return ts.tv_sec * 1000 + ts.tv_nsec / 1000000; }
+static inline rt_tick_t rt_tick_from_millisecond(int ms) { return ms; }
+static inline void *host_thread_entry(void *p) { void **a = p; ((void (*)(void *))a[0])(a[1]); return NULL; }
+static inline rt_thread_t rt_thread_create(const char *n, void (*e)(void *), void *p, int s, int pr, int t) { void **a = malloc(2 * sizeof(void *)); a[0] = (void *)e; a[1] = p; return (rt_thread_t)a; }
+static inline int rt_thread_startup(rt_thread_t t) { pthread_t th; return pthread_create(&th, NULL, host_thread_entry, t); }
+#endif
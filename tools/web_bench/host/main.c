@@ -0,0 +1,36 @@
+/*
+ * Host build of packages/webnet-v2.0.3 for web_bench.py.
+ *
+ * usage: webnet_host [port] [root]
+ *
+ * Serves the files under root (default "www") and /cgi-bin/hello.
+ */
+
+#include <signal.h>
+#include <rtthread.h>
+#include <webnet.h>
+#include <wn_module.h>
+
+int webnet_init(void);
+
+static void cgi_hello(struct webnet_session *session)
+{
+    static const char body[] = "{\"hello\":1}";
+
+    webnet_session_set_header(session, "application/json", 200, "OK", sizeof(body) - 1);
+    webnet_session_write(session, (const rt_uint8_t *)body, sizeof(body) - 1);
+}
+
+int main(int argc, char **argv)
+{
+    signal(SIGPIPE, SIG_IGN);
+    setvbuf(stdout, NULL, _IONBF, 0);
+
+    webnet_set_port((argc > 1) ? atoi(argv[1]) : 8080);
+    webnet_set_root((argc > 2) ? argv[2] : WEBNET_ROOT);
+    webnet_cgi_register("hello", cgi_hello);
+    webnet_init();
+
+    for (;;)
+        pause();
+}
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+webnet requests/second benchmark.
+
+Runs the same GET request against a webnet server in three modes:
+
+  close     one TCP connection per request (Connection: close)
+  keepalive one persistent connection, one request in flight
+  pipeline  one persistent connection, DEPTH requests in flight
+
+usage: web_bench.py [-p PORT] [-n COUNT] [-d DEPTH] [-m MODE] [--path PATH] host
+
+host/ builds webnet for the host, to measure without a board.
+"""
+
+import argparse
+import socket
+import time
+
+
+def build_request(host, path, keepalive):
+    return ("GET %s HTTP/1.1\r\nHost: %s\r\nConnection: %s\r\n\r\n" %
+            (path, host, "keep-alive" if keepalive else "close")).encode()
+
+
+class Reader(object):
+    def __init__(self, sock):
+        self.sock = sock
+        self.buf = b""
+
+    def _fill(self):
+        data = self.sock.recv(4096)
+        if not data:
+            raise ConnectionError("connection closed by server")
+        self.buf += data
+
+    def response(self):
+        """read one response, return (status, keep_alive)"""
+        while b"\r\n\r\n" not in self.buf:
+            self._fill()
+        head, self.buf = self.buf.split(b"\r\n\r\n", 1)
+        lines = head.decode("latin-1").split("\r\n")
+        status = int(lines[0].split()[1])
+        headers = {}
+        for line in lines[1:]:
+            key, _, value = line.partition(":")
+            headers[key.strip().lower()] = value.strip().lower()
+
+        if "content-length" in headers:
+            length = int(headers["content-length"])
+            while len(self.buf) < length:
+                self._fill()
+            self.buf = self.buf[length:]
+            return status, headers.get("connection") != "close"
+
+        # no length, the body ends with the connection
+        try:
+            while True:
+                self._fill()
+        except ConnectionError:
+            pass
+        self.buf = b""
+        return status, False
+
+
+def check(status):
+    if status != 200:
+        raise RuntimeError("server answered %d" % status)
+
+
+def connect(args):
+    sock = socket.create_connection((args.host, args.port), timeout=10)
+    sock.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+    return sock
+
+
+def bench_close(args):
+    request = build_request(args.host, args.path, False)
+    for _ in range(args.count):
+        sock = connect(args)
+        sock.sendall(request)
+        status, _ = Reader(sock).response()
+        sock.close()
+        check(status)
+    return args.count, args.count
+
+
+def bench_keepalive(args, depth):
+    request = build_request(args.host, args.path, True)
+    done = 0
+    connections = 0
+    while done < args.count:
+        sock = connect(args)
+        reader = Reader(sock)
+        connections += 1
+        alive = True
+        while alive and done < args.count:
+            inflight = min(depth, args.count - done)
+            sock.sendall(request * inflight)
+            for _ in range(inflight):
+                if not alive:
+                    break
+                status, alive = reader.response()
+                check(status)
+                done += 1
+        sock.close()
+    return done, connections
+
+
+def main():
+    parser = argparse.ArgumentParser(description="webnet requests/second benchmark")
+    parser.add_argument("host")
+    parser.add_argument("-p", "--port", type=int, default=80)
+    parser.add_argument("-n", "--count", type=int, default=200)
+    parser.add_argument("-d", "--depth", type=int, default=4)
+    parser.add_argument("-m", "--mode", action="append", choices=("close", "keepalive", "pipeline"),
+                        help="run only this mode, may be repeated")
+    parser.add_argument("--path", default="/")
+    args = parser.parse_args()
+
+    modes = (
+        ("close", lambda: bench_close(args)),
+        ("keepalive", lambda: bench_keepalive(args, 1)),
+        ("pipeline", lambda: bench_keepalive(args, args.depth)),
+    )
+    for name, run in modes:
+        if args.mode and name not in args.mode:
+            continue
+        start = time.time()
+        done, connections = run()
+        cost = time.time() - start
+        print("%-10s %5d requests %4d connections %8.3f s %8.1f req/s" %
+              (name, done, connections, cost, done / cost))
+
+
+if __name__ == "__main__":
+    main()